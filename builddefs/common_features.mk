@@ -42,6 +42,16 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(BINARY_LOG_ENABLE)), yes)
+    OPT_DEFS += -DBINARY_LOG_ENABLE
+    SRC += $(QUANTUM_DIR)/logging/binary_log.c
+    # Passed as an input file, so it adds to the main linker script instead of
+    # replacing it. Host tests keep the format strings loaded to look them up.
+    ifneq ($(strip $(PLATFORM_KEY)), test)
+        LDFLAGS += $(QUANTUM_DIR)/logging/binary_log.ld
+    endif
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -57,6 +67,9 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
         else ifeq ($(strip $(AUDIO_DRIVER)), dac_additive)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
+        else ifeq ($(strip $(AUDIO_DRIVER)), dac_wavetable)
+            OPT_DEFS += -DAUDIO_DRIVER_DAC
+            SRC += $(QUANTUM_DIR)/audio/wavetable_synth.c
         ## stm32f2 and above have a usable DAC unit, f1 do not, and need to use pwm instead
         else ifeq ($(strip $(AUDIO_DRIVER)), pwm_software)
             OPT_DEFS += -DAUDIO_DRIVER_PWM
@@ -87,12 +100,13 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     OPT_DEFS += -DMIDI_ENABLE
     MUSIC_ENABLE = yes
     COMMON_VPATH += $(QUANTUM_PATH)/midi
+    COMMON_VPATH += $(QUANTUM_PATH)/spsc_queue
     SRC += $(QUANTUM_DIR)/midi/midi.c
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
     SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/interrupt_setting.c
+    SRC += $(QUANTUM_DIR)/spsc_queue/spsc_queue.c
     SRC += $(QUANTUM_DIR)/process_keycode/process_midi.c
 endif
 
@@ -947,6 +961,12 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(LEADER_ENABLE)), yes)
+    ifeq ($(strip $(LEADER_TABLE_ENABLE)), yes)
+        OPT_DEFS += -DLEADER_TABLE_ENABLE
+    endif
+endif
+
 ifeq ($(strip $(BATTERY_ENABLE)), yes)
     BATTERY_DRIVER_REQUIRED := yes
 endif
@@ -42,6 +42,7 @@ GENERIC_FEATURES = \
     LAYER_LOCK \
     LEADER \
     MAGIC \
+    MATRIX_TELEMETRY \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
@@ -3,6 +3,7 @@ BUILD_OPTION_NAMES = \
   MOUSEKEY_ENABLE \
   EXTRAKEY_ENABLE \
   CONSOLE_ENABLE \
+  BINARY_LOG_ENABLE \
   COMMAND_ENABLE \
   NKRO_ENABLE \
   CUSTOM_MATRIX \
@@ -56,6 +57,7 @@ OTHER_OPTION_NAMES = \
   AUTOLOG_ENABLE \
   DEBUG_ENABLE \
   ENCODER_MAP_ENABLE \
+  LEADER_TABLE_ENABLE \
   ENCODER_ENABLE_CUSTOM \
   GERMAN_ENABLE \
   HAPTIC_ENABLE \
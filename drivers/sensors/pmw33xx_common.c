@@ -23,6 +23,16 @@ static const pin_t cs_pins_right[] = PMW33XX_CS_PINS_RIGHT;
 static bool in_burst_left[ARRAY_SIZE(cs_pins_left)]   = {0};
 static bool in_burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
 
+#ifdef PMW33XX_INTERLEAVED_READ
+// Motion read along with the first sensor, added up until pmw33xx_read_burst() of its sensor collects it
+static pmw33xx_report_t interleaved_report_left[ARRAY_SIZE(cs_pins_left)];
+static pmw33xx_report_t interleaved_report_right[ARRAY_SIZE(cs_pins_right)];
+static bool             has_interleaved_report_left[ARRAY_SIZE(cs_pins_left)]   = {0};
+static bool             has_interleaved_report_right[ARRAY_SIZE(cs_pins_right)] = {0};
+#    define interleaved_report (is_keyboard_left() ? interleaved_report_left : interleaved_report_right)
+#    define has_interleaved_report (is_keyboard_left() ? has_interleaved_report_left : has_interleaved_report_right)
+#endif
+
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
@@ -57,7 +67,8 @@ bool pmw33xx_spi_start(uint8_t sensor) {
     return true;
 }
 
-bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
+// Writes the register, but leaves waiting for tSWW/tSWR to the caller
+static bool pmw33xx_write_no_wait(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     if (!pmw33xx_spi_start(sensor)) {
         return false;
     }
@@ -75,6 +86,13 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     // tSCLK-NCS for write operation is 35us
     wait_us(35);
     spi_stop();
+    return true;
+}
+
+bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
+    if (!pmw33xx_write_no_wait(sensor, reg_addr, data)) {
+        return false;
+    }
 
     // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
     // a safe lower bound
@@ -197,21 +215,10 @@ bool pmw33xx_init(uint8_t sensor) {
     return true;
 }
 
-pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+// Clocks out the motion burst of a sensor that is already in burst mode
+static pmw33xx_report_t pmw33xx_receive_burst(uint8_t sensor) {
     pmw33xx_report_t report = {0};
 
-    if (sensor >= pmw33xx_number_of_sensors) {
-        return report;
-    }
-
-    if (!in_burst[sensor]) {
-        pd_dprintf("PMW33XX (%d): burst\n", sensor);
-        if (!pmw33xx_write(sensor, REG_Motion_Burst, 0x00)) {
-            return report;
-        }
-        in_burst[sensor] = true;
-    }
-
     if (!pmw33xx_spi_start(sensor)) {
         return report;
     }
@@ -236,6 +243,78 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
     return report;
 }
 
+pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+    pmw33xx_report_t report = {0};
+
+    if (sensor >= pmw33xx_number_of_sensors) {
+        return report;
+    }
+
+#ifdef PMW33XX_INTERLEAVED_READ
+    if (has_interleaved_report[sensor]) {
+        has_interleaved_report[sensor] = false;
+        return interleaved_report[sensor];
+    }
+#endif
+
+    if (!in_burst[sensor]) {
+        pd_dprintf("PMW33XX (%d): burst\n", sensor);
+        if (!pmw33xx_write(sensor, REG_Motion_Burst, 0x00)) {
+            return report;
+        }
+        in_burst[sensor] = true;
+    }
+
+    return pmw33xx_receive_burst(sensor);
+}
+
+void pmw33xx_read_burst_all_sensors(pmw33xx_report_t *reports) {
+    bool entered_burst = false;
+
+    // Sensors that left burst mode can settle from the write that re-enters it at the same time,
+    // sensors that are still in burst mode are read right away as before
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        if (!in_burst[sensor]) {
+            pd_dprintf("PMW33XX (%d): burst\n", sensor);
+            if (pmw33xx_write_no_wait(sensor, REG_Motion_Burst, 0x00)) {
+                in_burst[sensor] = true;
+                entered_burst    = true;
+            }
+        }
+    }
+    if (entered_burst) {
+        // tSWW/tSWR, see pmw33xx_write()
+        wait_us(145);
+    }
+
+    // Each burst has to be clocked out while its sensor stays selected, so they follow each other
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        reports[sensor] = in_burst[sensor] ? pmw33xx_receive_burst(sensor) : (pmw33xx_report_t){0};
+    }
+}
+
+#ifdef PMW33XX_INTERLEAVED_READ
+static void pmw33xx_hold_interleaved_report(uint8_t sensor, const pmw33xx_report_t *report) {
+    pmw33xx_report_t *held = &interleaved_report[sensor];
+
+    if (!has_interleaved_report[sensor]) {
+        *held                          = *report;
+        has_interleaved_report[sensor] = true;
+        return;
+    }
+
+    // The caller has not collected the previous motion yet, so none of it may be dropped
+    bool    is_motion = held->motion.b.is_motion || report->motion.b.is_motion;
+    int16_t delta_x   = CONSTRAIN((int32_t)held->delta_x + report->delta_x, INT16_MIN, INT16_MAX);
+    int16_t delta_y   = CONSTRAIN((int32_t)held->delta_y + report->delta_y, INT16_MIN, INT16_MAX);
+
+    *held                    = *report;
+    held->motion.b.is_motion = is_motion;
+    held->delta_x            = delta_x;
+    held->delta_y            = delta_y;
+}
+#endif
+
 bool pmw33xx_init_wrapper(void) {
     return pmw33xx_init(0);
 }
@@ -249,8 +328,17 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
+#ifdef PMW33XX_INTERLEAVED_READ
+    pmw33xx_report_t reports[MAX(ARRAY_SIZE(cs_pins_left), ARRAY_SIZE(cs_pins_right))];
+    pmw33xx_read_burst_all_sensors(reports);
+    for (uint8_t sensor = 1; sensor < pmw33xx_number_of_sensors; sensor++) {
+        pmw33xx_hold_interleaved_report(sensor, &reports[sensor]);
+    }
+    pmw33xx_report_t report = reports[0];
+#else
+    pmw33xx_report_t report = pmw33xx_read_burst(0);
+#endif
+    static bool in_motion = false;
 
     if (report.motion.b.is_lifted) {
         return mouse_report;
@@ -154,6 +154,16 @@ void pmw33xx_set_cpi_all_sensors(uint16_t cpi);
  */
 pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor);
 
+/**
+ * @brief Reads and clears the current delta, and motion register values on
+ * all sensors. Sensors that need to enter burst mode first wait for it
+ * together, and the bursts are read back-to-back.
+ *
+ * @param reports Receives the values of each sensor, must hold one report per
+ * sensor. If errors occurred all fields of that sensor are set to zero
+ */
+void pmw33xx_read_burst_all_sensors(pmw33xx_report_t *reports);
+
 /**
  * @brief Read one byte of data from the given register on the sensor
  *
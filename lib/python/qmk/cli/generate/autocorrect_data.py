@@ -49,6 +49,15 @@ TYPO_CHARS = dict([
 ] + [(chr(c), c + KC_A - ord('a')) for c in range(ord('a'),
                                                   ord('z') + 1)])  # Characters a-z.
 
+# Bit of each typo character in the child mask of a bitmap-indexed node.
+TYPO_BITS = dict([(chr(c), c - ord('a')) for c in range(ord('a'), ord('z') + 1)] + [
+    ("'", 26),
+    (':', 27),
+])
+
+# Branch nodes with at least this many children are bitmap-indexed, where that is no larger than a list of children.
+BITMAP_MIN_CHILDREN = 4
+
 
 def parse_file(file_name: str) -> List[Tuple[str, str]]:
     """Parses autocorrections dictionary file.
@@ -165,11 +174,12 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], bitmap_index: bool = False) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    bitmap_index: Whether to index the children of large branch nodes with a bitmap, so they are found in constant time.
   Returns:
     List of ints in the range 0-255.
   """
@@ -217,6 +227,14 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
             return e['data']
         elif len(e['links']) == 1:  # Handle a chain table entry.
             return [TYPO_CHARS[c] for c in e['chars']] + [0]  # + encode_link(e['links'][0]))
+        elif bitmap_index and len(e['links']) >= BITMAP_MIN_CHILDREN:  # Handle a bitmap-indexed branch table entry.
+            mask = 0
+            for c in e['chars']:
+                mask |= 1 << TYPO_BITS[c]
+            data = [64] + list(mask.to_bytes(4, 'little'))
+            for c, link in sorted(zip(e['chars'], e['links']), key=lambda child: TYPO_BITS[child[0]]):
+                data += encode_link(link)
+            return data
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
@@ -253,12 +271,13 @@ def to_hex(b: int) -> str:
 @cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a output file is supplied.')
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a output file is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-b', '--bitmap-index', arg_only=True, action='store_true', help="Index large trie nodes with a bitmap for constant time lookups, recommended for large dictionaries")
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    data = serialize_trie(autocorrections, trie, cli.args.bitmap_index)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -0,0 +1,248 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "audio.h"
+#include "gpio.h"
+#include "util.h"
+#include "wavetable_synth.h"
+
+/*
+  Audio Driver: DAC
+
+  which utilizes the dac unit many STM32 are equipped with, to output a waveform rendered by the
+  integer-only wavetable synthesizer; every active tone gets its own voice with an ADSR envelope
+
+  the waveform of each voice can be selected by implementing/overriding 'dac_wavetable_voice_waveform'
+*/
+
+#if !defined(AUDIO_PIN)
+#    error "Audio feature enabled, but no suitable pin selected as AUDIO_PIN - see docs/feature_audio under 'ARM (DAC wavetable)' for available options."
+#endif
+#if defined(AUDIO_PIN_ALT) && !defined(AUDIO_PIN_ALT_AS_NEGATIVE)
+#    pragma message "Audio feature: AUDIO_PIN_ALT set, but not AUDIO_PIN_ALT_AS_NEGATIVE - pin will be left unused; audio might still work though."
+#endif
+
+#if !defined(AUDIO_PIN_ALT)
+// no ALT pin defined is valid, but the c-ifs below need some value set
+#    define AUDIO_PIN_ALT PAL_NOLINE
+#endif
+
+#ifndef AUDIO_DAC_WAVETABLE_WAVEFORM
+#    define AUDIO_DAC_WAVETABLE_WAVEFORM WAVETABLE_SYNTH_WAVEFORM_SINE
+#endif
+#ifndef AUDIO_DAC_WAVETABLE_ATTACK_MS
+#    define AUDIO_DAC_WAVETABLE_ATTACK_MS 5
+#endif
+#ifndef AUDIO_DAC_WAVETABLE_DECAY_MS
+#    define AUDIO_DAC_WAVETABLE_DECAY_MS 50
+#endif
+#ifndef AUDIO_DAC_WAVETABLE_SUSTAIN
+#    define AUDIO_DAC_WAVETABLE_SUSTAIN 192
+#endif
+#ifndef AUDIO_DAC_WAVETABLE_RELEASE_MS
+#    define AUDIO_DAC_WAVETABLE_RELEASE_MS 20
+#endif
+
+/* The gpt timer runs with 3*AUDIO_DAC_SAMPLE_RATE and the DAC converts on every
+ * second update event, which leaves 1.5*AUDIO_DAC_SAMPLE_RATE conversions per second
+ * (see the 2/3 correction in audio_dac_additive.c).
+ */
+#define DAC_WAVETABLE_OUTPUT_RATE (AUDIO_DAC_SAMPLE_RATE * 3 / 2)
+
+#define DAC_WAVETABLE_VOICES MIN(AUDIO_MAX_SIMULTANEOUS_TONES, WAVETABLE_SYNTH_VOICES)
+
+static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
+
+static const wavetable_synth_envelope_t dac_wavetable_envelope = {
+    .attack_ms  = AUDIO_DAC_WAVETABLE_ATTACK_MS,
+    .decay_ms   = AUDIO_DAC_WAVETABLE_DECAY_MS,
+    .sustain    = AUDIO_DAC_WAVETABLE_SUSTAIN,
+    .release_ms = AUDIO_DAC_WAVETABLE_RELEASE_MS,
+};
+
+// unprocessed frequency of the tone each voice is assigned to, in Q16.16 Hz; 0 if free or released
+static uint32_t voice_tone[DAC_WAVETABLE_VOICES];
+// frequency each voice is currently playing, in Q16.16 Hz
+static uint32_t voice_frequency[DAC_WAVETABLE_VOICES];
+
+static bool    tones_changed = false;
+static bool    stopping      = true;
+static uint8_t off_cycles    = 0;
+
+/**
+ * Selects the waveform of a voice. Declared weak so users can override it, e.g.
+ * to give the melody and the accompaniment of a song different timbres.
+ */
+__attribute__((weak)) wavetable_synth_waveform_t dac_wavetable_voice_waveform(uint8_t voice) {
+    (void)voice;
+    return AUDIO_DAC_WAVETABLE_WAVEFORM;
+}
+
+/**
+ * Voices follow tones by their unprocessed frequency rather than by their index,
+ * which shifts whenever a tone starts or stops.
+ */
+static void dac_wavetable_sync_voices(void) {
+    uint8_t  active_tones = stopping ? 0 : MIN(DAC_WAVETABLE_VOICES, audio_get_number_of_active_tones());
+    uint32_t tone[DAC_WAVETABLE_VOICES];
+    uint32_t frequency[DAC_WAVETABLE_VOICES];
+    bool     assigned[DAC_WAVETABLE_VOICES] = {false};
+
+    for (uint8_t i = 0; i < active_tones; i++) {
+        // the only float math left: once per tone, and only when the tones changed
+        tone[i]      = (uint32_t)(audio_get_frequency(i) * 65536.0f);
+        frequency[i] = (uint32_t)(audio_get_processed_frequency(i) * 65536.0f);
+    }
+
+    // keep every voice on its tone, e.g. through vibrato, and release the ones whose tone stopped
+    for (uint8_t v = 0; v < DAC_WAVETABLE_VOICES; v++) {
+        if (voice_tone[v] == 0) {
+            continue;
+        }
+        uint8_t i = 0;
+        while (i < active_tones && (assigned[i] || tone[i] != voice_tone[v])) {
+            i++;
+        }
+        if (i == active_tones) {
+            wavetable_synth_note_off(v);
+            voice_tone[v] = 0;
+            continue;
+        }
+        assigned[i] = true;
+        if (frequency[i] != voice_frequency[v]) {
+            wavetable_synth_set_frequency(v, frequency[i]);
+            voice_frequency[v] = frequency[i];
+        }
+    }
+
+    // start new tones on a free voice, preferring one that has finished its release; 'rest' notes are silent
+    for (uint8_t i = 0; i < active_tones; i++) {
+        if (assigned[i] || tone[i] == 0) {
+            continue;
+        }
+        uint8_t voice = DAC_WAVETABLE_VOICES;
+        for (uint8_t v = 0; v < DAC_WAVETABLE_VOICES; v++) {
+            if (voice_tone[v] != 0) {
+                continue;
+            }
+            if (voice == DAC_WAVETABLE_VOICES || !wavetable_synth_voice_is_active(v)) {
+                voice = v;
+            }
+            if (!wavetable_synth_voice_is_active(v)) {
+                break;
+            }
+        }
+        if (voice == DAC_WAVETABLE_VOICES) {
+            break;
+        }
+        wavetable_synth_note_on(voice, frequency[i], dac_wavetable_voice_waveform(voice), &dac_wavetable_envelope);
+        voice_tone[voice]      = tone[i];
+        voice_frequency[voice] = frequency[i];
+    }
+}
+
+/**
+ * DAC streaming callback. Does all of the main computing for playing songs.
+ *
+ * Note: chibios calls this CB twice: during the 'half buffer event', and the 'full buffer event'.
+ */
+static void dac_end(DACDriver *dacp) {
+    dacsample_t *sample_p = (dacp)->samples;
+
+    // work on the other half of the buffer
+    if (dacIsBufferComplete(dacp)) {
+        sample_p += AUDIO_DAC_BUFFER_SIZE / 2; // 'half_index'
+    }
+
+    // update audio internal state (note position, current_note, ...)
+    if (audio_update_state() || tones_changed) {
+        tones_changed = false;
+        dac_wavetable_sync_voices();
+    }
+
+    // the envelopes ramp from and to AUDIO_DAC_OFF_VALUE, so there is no need to wait for a zero crossing
+    wavetable_synth_render(sample_p, AUDIO_DAC_BUFFER_SIZE / 2, AUDIO_DAC_OFF_VALUE, MIN(AUDIO_DAC_OFF_VALUE, AUDIO_DAC_SAMPLE_MAX - AUDIO_DAC_OFF_VALUE));
+
+    if (stopping && !wavetable_synth_is_active()) {
+        // trailing off: giving the DAC two more conversion cycles until the AUDIO_DAC_OFF_VALUE reaches the output, then turn the timer off, which leaves the output at that level
+        if (off_cycles < 2) {
+            off_cycles++;
+        } else {
+            gptStopTimer(&GPTD6);
+        }
+    }
+}
+
+static void dac_error(DACDriver *dacp, dacerror_t err) {
+    (void)dacp;
+    (void)err;
+
+    chSysHalt("DAC failure. halp");
+}
+
+static const GPTConfig gpt6cfg1 = {.frequency = AUDIO_DAC_SAMPLE_RATE * 3,
+                                   .callback  = NULL,
+                                   .cr2       = TIM_CR2_MMS_1, /* MMS = 010 = TRGO on Update Event.  */
+                                   .dier      = 0U};
+
+static const DACConfig dac_conf = {.init = AUDIO_DAC_OFF_VALUE, .datamode = DAC_DHRM_12BIT_RIGHT};
+
+/**
+ * @note The DAC_TRG(0) here selects the Timer 6 TRGO event; see audio_dac_additive.c for the other values.
+ */
+static const DACConversionGroup dac_conv_cfg = {.num_channels = 1U, .end_cb = dac_end, .error_cb = dac_error, .trigger = DAC_TRG(0b000)};
+
+void audio_driver_initialize_impl(void) {
+    wavetable_synth_init(DAC_WAVETABLE_OUTPUT_RATE);
+
+    if ((AUDIO_PIN == A4) || (AUDIO_PIN_ALT == A4)) {
+        palSetLineMode(A4, PAL_MODE_INPUT_ANALOG);
+        dacStart(&DACD1, &dac_conf);
+    }
+    if ((AUDIO_PIN == A5) || (AUDIO_PIN_ALT == A5)) {
+        palSetLineMode(A5, PAL_MODE_INPUT_ANALOG);
+        dacStart(&DACD2, &dac_conf);
+    }
+
+    // enable the output buffer, see audio_dac_additive.c
+    DACD1.params->dac->CR &= ~DAC_CR_BOFF1;
+    DACD2.params->dac->CR &= ~DAC_CR_BOFF2;
+
+    for (size_t i = 0; i < AUDIO_DAC_BUFFER_SIZE; i++) {
+        dac_buffer[i] = AUDIO_DAC_OFF_VALUE;
+    }
+
+    if (AUDIO_PIN == A4) {
+        dacStartConversion(&DACD1, &dac_conv_cfg, dac_buffer, AUDIO_DAC_BUFFER_SIZE);
+    } else if (AUDIO_PIN == A5) {
+        dacStartConversion(&DACD2, &dac_conv_cfg, dac_buffer, AUDIO_DAC_BUFFER_SIZE);
+    }
+
+#if defined(AUDIO_PIN_ALT_AS_NEGATIVE)
+    if (AUDIO_PIN_ALT == A4) {
+        dacPutChannelX(&DACD1, 0, AUDIO_DAC_OFF_VALUE);
+    } else if (AUDIO_PIN_ALT == A5) {
+        dacPutChannelX(&DACD2, 0, AUDIO_DAC_OFF_VALUE);
+    }
+#endif
+
+    gptStart(&GPTD6, &gpt6cfg1);
+}
+
+void audio_driver_stop_impl(void) {
+    // release all voices; the timer is stopped from dac_end once they have faded out
+    osalSysLock();
+    stopping      = true;
+    tones_changed = true;
+    osalSysUnlock();
+}
+
+void audio_driver_start_impl(void) {
+    osalSysLock();
+    stopping      = false;
+    tones_changed = true;
+    off_cycles    = 0;
+    osalSysUnlock();
+
+    gptStartContinuous(&GPTD6, 2U);
+}
@@ -54,6 +54,7 @@
  *
  * FEE_PAGE_COUNT   # Total number of pages to use for eeprom simulation (Compact + Write log)
  * FEE_DENSITY_BYTES   # Size of simulated eeprom. (Defaults to half the space allocated by FEE_PAGE_COUNT)
+ * FEE_WRITE_BATCH_SIZE   # Maximum number of consecutive half-words programmed in one go. (Defaults to 32)
  * NOTE: The current implementation does not include page swapping,
  * and FEE_DENSITY_BYTES will consume that amount of RAM as a cached view of actual EEPROM contents.
  *
@@ -79,6 +80,9 @@
  * Otherwise:
  * If the write log is full, erase both the Compacted-flash area and the Write log, then write cached contents to the Compacted-flash area.
  * Otherwise a Write log entry is constructed and appended to the next free position in the Write log.
+ * Half-words for consecutive flash addresses are queued up and programmed together, unlocking the flash once,
+ * when the outermost write call returns. A block write of consecutive words, either directly into Compacted-flash
+ * or into the Write log, therefore takes a single flash program burst instead of one per half-word.
  *
  *
  * *** Write Log Structure ***
@@ -144,6 +148,11 @@
 /* Flash word value after erase */
 #define FEE_EMPTY_WORD ((uint16_t)0xFFFF)
 
+/* Number of consecutive half-words that are programmed in one go */
+#ifndef FEE_WRITE_BATCH_SIZE
+#    define FEE_WRITE_BATCH_SIZE 32
+#endif
+
 #if !defined(FEE_PAGE_SIZE) || !defined(FEE_PAGE_COUNT) || !defined(FEE_MCU_FLASH_SIZE) || !defined(FEE_PAGE_BASE_ADDRESS)
 #    error "not implemented."
 #endif
@@ -156,6 +165,14 @@ static uint8_t *DataBuf = (uint8_t *)WordBuf;
 /* Pointer to the first available slot within the write log */
 static uint16_t *empty_slot;
 
+/* Half-words waiting to be programmed to consecutive flash addresses, starting at pending_address */
+static uint16_t  pending_data[FEE_WRITE_BATCH_SIZE];
+static uintptr_t pending_address;
+static uint8_t   pending_count;
+
+/* Nesting depth of write calls, pending half-words are programmed when the outermost one returns */
+static uint8_t batch_depth;
+
 // #define DEBUG_EEPROM_OUTPUT
 
 /*
@@ -289,8 +306,61 @@ uint16_t EEPROM_Init(void) {
     return FEE_DENSITY_BYTES;
 }
 
+/* Program the pending half-words to flash */
+static FLASH_Status eeprom_flush(void) {
+    if (!pending_count) return FLASH_COMPLETE;
+
+    FLASH_Unlock();
+
+    eeprom_printf("FLASH_ProgramHalfWords(0x%08lx, %d)\n", (uint32_t)pending_address, pending_count);
+    FLASH_Status status = FLASH_ProgramHalfWords(pending_address, pending_data, pending_count);
+
+    FLASH_Lock();
+
+    pending_count = 0;
+    return status;
+}
+
+/* Queue a half-word to be programmed, flushing the pending ones first if it doesn't follow them */
+static FLASH_Status eeprom_program(uintptr_t address, uint16_t value) {
+    FLASH_Status status = FLASH_COMPLETE;
+    if (pending_count && (pending_count == FEE_WRITE_BATCH_SIZE || address != pending_address + pending_count * 2)) {
+        status = eeprom_flush();
+    }
+    if (!pending_count) {
+        pending_address = address;
+    }
+    eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x) [QUEUED]\n", (uint32_t)address, value);
+    pending_data[pending_count++] = value;
+    return status;
+}
+
+/* Pending half-word for the given flash address, or NULL if there is none */
+static uint16_t *eeprom_pending(uintptr_t address) {
+    if (pending_count && address >= pending_address && address < pending_address + pending_count * 2) {
+        return &pending_data[(address - pending_address) / 2];
+    }
+    return NULL;
+}
+
+static void eeprom_begin_batch(void) {
+    ++batch_depth;
+}
+
+/* Flush the pending half-words if this ends the outermost write, and merge the result into status */
+static FLASH_Status eeprom_end_batch(FLASH_Status status) {
+    if (--batch_depth == 0) {
+        FLASH_Status flush_status = eeprom_flush();
+        if (flush_status != FLASH_COMPLETE) status = flush_status;
+    }
+    return status;
+}
+
 /* Clear flash contents (doesn't touch in-memory DataBuf) */
 static void eeprom_clear(void) {
+    /* Pending writes are already in DataBuf, and would be rewritten by compaction anyway */
+    pending_count = 0;
+
     FLASH_Unlock();
 
     for (uint16_t page_num = 0; page_num < FEE_PAGE_COUNT; ++page_num) {
@@ -318,8 +388,6 @@ static uint8_t eeprom_compact(void) {
     /* Erase compacted pages and write log */
     eeprom_clear();
 
-    FLASH_Unlock();
-
     FLASH_Status final_status = FLASH_COMPLETE;
 
     /* Write emulated eeprom contents from memory to compacted flash */
@@ -329,13 +397,13 @@ static uint8_t eeprom_compact(void) {
     for (; dest < FEE_COMPACTED_LAST_ADDRESS; ++src, dest += 2) {
         value = *src;
         if (value) {
-            eeprom_printf("FLASH_ProgramHalfWord(0x%04lx, 0x%04x)\n", (uint32_t)dest, ~value);
-            FLASH_Status status = FLASH_ProgramHalfWord(dest, ~value);
+            FLASH_Status status = eeprom_program(dest, ~value);
             if (status != FLASH_COMPLETE) final_status = status;
         }
     }
 
-    FLASH_Lock();
+    FLASH_Status status = eeprom_flush();
+    if (status != FLASH_COMPLETE) final_status = status;
 
     if (debug_eeprom) {
         println("eeprom_compacted:");
@@ -348,19 +416,20 @@ static uint8_t eeprom_compact(void) {
 static uint8_t eeprom_write_direct_entry(uint16_t Address) {
     /* Check if we can just write this directly to the compacted flash area */
     uintptr_t directAddress = FEE_COMPACTED_BASE_ADDRESS + (Address & 0xFFFE);
+    uint16_t  value         = ~*(uint16_t *)(&DataBuf[Address & 0xFFFE]);
+    /* A pending direct write hasn't reached flash yet, so it can still be replaced */
+    uint16_t *pending = eeprom_pending(directAddress);
+    if (pending) {
+        eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x) [DIRECT, REPLACED]\n", (uint32_t)directAddress, value);
+        *pending = value;
+        return FLASH_COMPLETE;
+    }
     if (*(uint16_t *)directAddress == FEE_EMPTY_WORD) {
         /* Write the value directly to the compacted area without a log entry */
-        uint16_t value = ~*(uint16_t *)(&DataBuf[Address & 0xFFFE]);
         /* Early exit if a write isn't needed */
         if (value == FEE_EMPTY_WORD) return FLASH_COMPLETE;
 
-        FLASH_Unlock();
-
-        eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x) [DIRECT]\n", (uint32_t)directAddress, value);
-        FLASH_Status status = FLASH_ProgramHalfWord(directAddress, value);
-
-        FLASH_Lock();
-        return status;
+        return eeprom_program(directAddress, value);
     }
     return 0;
 }
@@ -395,21 +464,15 @@ static uint8_t eeprom_write_log_word_entry(uint16_t Address) {
     Address |= encoding;
 
     /* ok we found a place let's write our data */
-    FLASH_Unlock();
-
     /* address */
-    eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x)\n", (uint32_t)empty_slot, Address);
-    final_status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, Address);
+    final_status = eeprom_program((uintptr_t)empty_slot++, Address);
 
     /* value */
     if (encoding == (FEE_WORD_ENCODING | FEE_VALUE_NEXT)) {
-        eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x)\n", (uint32_t)empty_slot, ~value);
-        FLASH_Status status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, ~value);
+        FLASH_Status status = eeprom_program((uintptr_t)empty_slot++, ~value);
         if (status != FLASH_COMPLETE) final_status = status;
     }
 
-    FLASH_Lock();
-
     return final_status;
 }
 
@@ -423,18 +486,11 @@ static uint8_t eeprom_write_log_byte_entry(uint16_t Address) {
     }
 
     /* ok we found a place let's write our data */
-    FLASH_Unlock();
-
     /* Pack address and value into the same word */
     uint16_t value = (Address << 8) | DataBuf[Address];
 
     /* write to flash */
-    eeprom_printf("FLASH_ProgramHalfWord(0x%08lx, 0x%04x)\n", (uint32_t)empty_slot, value);
-    FLASH_Status status = FLASH_ProgramHalfWord((uintptr_t)empty_slot++, value);
-
-    FLASH_Lock();
-
-    return status;
+    return eeprom_program((uintptr_t)empty_slot++, value);
 }
 
 uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
@@ -455,6 +511,7 @@ uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
     eeprom_printf("EEPROM_WriteDataByte DataBuf[0x%04x] = 0x%02x\n", Address, DataBuf[Address]);
 
     /* perform the write into flash memory */
+    eeprom_begin_batch();
     /* First, attempt to write directly into the compacted flash area */
     FLASH_Status status = eeprom_write_direct_entry(Address);
     if (!status) {
@@ -465,6 +522,7 @@ uint8_t EEPROM_WriteDataByte(uint16_t Address, uint8_t DataByte) {
             status = eeprom_write_log_word_entry(Address & 0xFFFE);
         }
     }
+    status = eeprom_end_batch(status);
     if (status != 0 && status != FLASH_COMPLETE) {
         eeprom_printf("EEPROM_WriteDataByte [STATUS == %d]\n", status);
     }
@@ -481,9 +539,11 @@ uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
     /* Check for word alignment */
     FLASH_Status final_status = FLASH_COMPLETE;
     if (Address % 2) {
+        eeprom_begin_batch();
         final_status        = EEPROM_WriteDataByte(Address, DataWord);
         FLASH_Status status = EEPROM_WriteDataByte(Address + 1, DataWord >> 8);
         if (status != FLASH_COMPLETE) final_status = status;
+        final_status = eeprom_end_batch(final_status);
         if (final_status != 0 && final_status != FLASH_COMPLETE) {
             eeprom_printf("EEPROM_WriteDataWord [STATUS == %d]\n", final_status);
         }
@@ -502,6 +562,7 @@ uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
     eeprom_printf("EEPROM_WriteDataWord DataBuf[0x%04x] = 0x%04x\n", Address, *(uint16_t *)(&DataBuf[Address]));
 
     /* perform the write into flash memory */
+    eeprom_begin_batch();
     /* First, attempt to write directly into the compacted flash area */
     final_status = eeprom_write_direct_entry(Address);
     if (!final_status) {
@@ -523,6 +584,7 @@ uint8_t EEPROM_WriteDataWord(uint16_t Address, uint16_t DataWord) {
             final_status = eeprom_write_log_word_entry(Address);
         }
     }
+    final_status = eeprom_end_batch(final_status);
     if (final_status != 0 && final_status != FLASH_COMPLETE) {
         eeprom_printf("EEPROM_WriteDataWord [STATUS == %d]\n", final_status);
     }
@@ -609,6 +671,9 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     uint8_t       *dest = (uint8_t *)addr;
     const uint8_t *src  = (const uint8_t *)buf;
 
+    /* Program the whole block in as few bursts as possible */
+    eeprom_begin_batch();
+
     /* Check word alignment */
     if (len && (uintptr_t)dest % 2) {
         /* Write the unaligned first byte */
@@ -633,4 +698,6 @@ void eeprom_write_block(const void *buf, void *addr, size_t len) {
     if (len) {
         EEPROM_WriteDataByte((uintptr_t)dest, *src);
     }
+
+    eeprom_end_batch(FLASH_COMPLETE);
 }
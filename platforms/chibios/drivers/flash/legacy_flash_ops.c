@@ -184,6 +184,46 @@ FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data) {
     return status;
 }
 
+/**
+ * @brief  Programs consecutive half words, starting at a specified address.
+ *         The programming mode is only entered and left once for all of them.
+ * @param  Address: specifies the address of the first half word.
+ * @param  Data: specifies the data to be programmed.
+ * @param  Count: specifies the number of half words.
+ * @retval FLASH Status: The returned value can be: FLASH_ERROR_PG,
+ *   FLASH_ERROR_WRP, FLASH_COMPLETE, FLASH_TIMEOUT or FLASH_BAD_ADDRESS.
+ */
+FLASH_Status FLASH_ProgramHalfWords(uint32_t Address, const uint16_t *Data, uint16_t Count) {
+    FLASH_Status status = FLASH_BAD_ADDRESS;
+
+    if (!Count) return FLASH_COMPLETE;
+
+    if (IS_FLASH_ADDRESS(Address) && IS_FLASH_ADDRESS(Address + (Count - 1) * 2)) {
+        /* Wait for last operation to be completed */
+        status = FLASH_WaitForLastOperation(ProgramTimeout);
+        if (status == FLASH_COMPLETE) {
+            /* if the previous operation is completed, proceed to program the new data */
+
+#if defined(FLASH_CR_PSIZE)
+            FLASH->CR &= ~FLASH_CR_PSIZE;
+            FLASH->CR |= FLASH_CR_PSIZE_0;
+#endif
+            FLASH->CR |= FLASH_CR_PG;
+            for (; Count && status == FLASH_COMPLETE; --Count, Address += 2) {
+                *(__IO uint16_t *)Address = *Data++;
+                /* Wait for last operation to be completed */
+                status = FLASH_WaitForLastOperation(ProgramTimeout);
+            }
+            if (status != FLASH_TIMEOUT) {
+                /* if the program operation is completed, disable the PG Bit */
+                FLASH->CR &= ~FLASH_CR_PG;
+            }
+            FLASH->SR = (FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPERR);
+        }
+    }
+    return status;
+}
+
 /**
  * @brief  Unlocks the FLASH Program Erase Controller.
  * @param  None
@@ -26,6 +26,11 @@ extern "C" {
 
 #ifdef LEGACY_FLASH_OPS_MOCKED
 extern uint8_t FlashBuf[MOCK_FLASH_SIZE];
+
+/* Number of flash operations, a bulk program counting as a single one */
+extern uint32_t FlashEraseCount;
+extern uint32_t FlashProgramCount;
+extern uint32_t FlashUnlockCount;
 #endif
 
 typedef enum { FLASH_BUSY = 1, FLASH_ERROR_PG, FLASH_ERROR_WRP, FLASH_ERROR_OPT, FLASH_COMPLETE, FLASH_TIMEOUT, FLASH_BAD_ADDRESS } FLASH_Status;
@@ -35,6 +40,7 @@ typedef enum { FLASH_BUSY = 1, FLASH_ERROR_PG, FLASH_ERROR_WRP, FLASH_ERROR_OPT,
 FLASH_Status FLASH_WaitForLastOperation(uint32_t Timeout);
 FLASH_Status FLASH_ErasePage(uint32_t Page_Address);
 FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data);
+FLASH_Status FLASH_ProgramHalfWords(uint32_t Address, const uint16_t *Data, uint16_t Count);
 
 void FLASH_Unlock(void);
 void FLASH_Lock(void);
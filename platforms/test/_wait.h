@@ -18,5 +18,9 @@
 #include <inttypes.h>
 
 void wait_ms(uint32_t ms);
-#define wait_us(us) wait_ms(us / 1000)
+#ifdef WAIT_US_MOCKED
+void wait_us(uint32_t us);
+#else
+#    define wait_us(us) wait_ms(us / 1000)
+#endif
 #define waitInputPinDelay()
@@ -69,6 +69,12 @@ class EepromStm32Test : public testing::Test {
         dumpEepromDataBuf();
 #endif
     }
+
+    void resetFlashCounts() {
+        FlashEraseCount   = 0;
+        FlashProgramCount = 0;
+        FlashUnlockCount  = 0;
+    }
 };
 
 TEST_F(EepromStm32Test, TestErase) {
@@ -400,6 +406,84 @@ TEST_F(EepromStm32Test, TestBlockRoundTrip) {
     EXPECT_EQ(strcmp((char*)src1, dst1d), 0);
 }
 
+TEST_F(EepromStm32Test, TestWriteProgramsOnce) {
+    resetFlashCounts();
+    EEPROM_WriteDataByte(2, 0xef);
+    EXPECT_EQ(FlashProgramCount, 1);
+    EXPECT_EQ(FlashUnlockCount, 1);
+    resetFlashCounts();
+    EEPROM_WriteDataWord(EEPROM_SIZE - 4, 0x5678);
+    EXPECT_EQ(FlashProgramCount, 1);
+    EXPECT_EQ(FlashUnlockCount, 1);
+    EEPROM_WriteDataWord(EEPROM_SIZE - 2, 0x9abc);
+    /* Unaligned word spanning two log entries */
+    resetFlashCounts();
+    EEPROM_WriteDataWord(EEPROM_SIZE - 3, 0x1234);
+    EXPECT_EQ(FlashProgramCount, 1);
+    EXPECT_EQ(FlashUnlockCount, 1);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], WORD_NEXT(EEPROM_SIZE - 4));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 4], WORD_NEXT(EEPROM_SIZE - 2));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 8], 0xFFFF);
+    /* Skipped writes don't touch flash */
+    resetFlashCounts();
+    EEPROM_WriteDataByte(2, 0xef);
+    EXPECT_EQ(FlashProgramCount, 0);
+    EXPECT_EQ(FlashUnlockCount, 0);
+}
+
+TEST_F(EepromStm32Test, TestBlockWriteIsBatched) {
+    uint8_t block[32];
+    for (uint8_t i = 0; i < sizeof(block); i++) {
+        block[i] = 0x80 + i;
+    }
+    /* Direct compacted-area writes */
+    resetFlashCounts();
+    eeprom_write_block(block, (void*)0x80, sizeof(block));
+    EXPECT_EQ(FlashProgramCount, 1);
+    EXPECT_EQ(FlashUnlockCount, 1);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[EEPROM_BASE + 0x80], (uint16_t)~0x8180);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[EEPROM_BASE + 0x9e], (uint16_t)~0x9f9e);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
+
+    /* Write log entries, two half-words per word */
+    for (uint8_t i = 0; i < sizeof(block); i++) {
+        block[i] = 0x40 + i;
+    }
+    resetFlashCounts();
+    eeprom_write_block(block, (void*)0x80, sizeof(block));
+    EXPECT_EQ(FlashProgramCount, 1);
+    EXPECT_EQ(FlashUnlockCount, 1);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE], WORD_NEXT(0x80));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 2], (uint16_t)~0x4140);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 60], WORD_NEXT(0x9e));
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 62], (uint16_t)~0x5f5e);
+    EXPECT_EQ(*(uint16_t*)&FlashBuf[LOG_BASE + 64], 0xFFFF);
+
+    /* Check values */
+    uint8_t dstBuf[sizeof(block)] = {0};
+    EEPROM_Init();
+    eeprom_read_block(dstBuf, (void*)0x80, sizeof(dstBuf));
+    EXPECT_EQ(memcmp(block, dstBuf, sizeof(block)), 0);
+}
+
+TEST_F(EepromStm32Test, TestLargeBlockWriteIsSplit) {
+    uint8_t block[128];
+    for (uint8_t i = 0; i < sizeof(block); i++) {
+        block[i] = ~i;
+    }
+    /* 64 half-words, programmed in bursts of at most 32 */
+    resetFlashCounts();
+    eeprom_write_block(block, (void*)0, sizeof(block));
+    EXPECT_EQ(FlashProgramCount, 2);
+    EXPECT_EQ(FlashUnlockCount, 2);
+
+    /* Check values */
+    uint8_t dstBuf[sizeof(block)] = {0};
+    EEPROM_Init();
+    eeprom_read_block(dstBuf, (void*)0, sizeof(dstBuf));
+    EXPECT_EQ(memcmp(block, dstBuf, sizeof(block)), 0);
+}
+
 TEST_F(EepromStm32Test, TestCompaction) {
     /* Direct writes */
     eeprom_write_dword((uint32_t*)0, 0xdeadbeef);
@@ -425,7 +509,11 @@ TEST_F(EepromStm32Test, TestCompaction) {
     EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE], 0xFFFF);
     EXPECT_NE(*(uint16_t*)&FlashBuf[LOG_BASE + LOG_SIZE - 2], 0xFFFF);
     /* Run compaction */
+    resetFlashCounts();
     eeprom_write_byte((uint8_t*)4, 0x1f);
+    /* One burst per run of non-zero words: 0..7, 150..153 and 200..203 */
+    EXPECT_EQ(FlashEraseCount, FEE_PAGE_COUNT);
+    EXPECT_EQ(FlashProgramCount, 3);
     EEPROM_Init();
     EXPECT_EQ(eeprom_read_dword((uint32_t*)0), 0xdeadbeef);
     EXPECT_EQ(eeprom_read_byte((uint8_t*)4), 0x1f);
@@ -20,9 +20,14 @@
 
 uint8_t FlashBuf[MOCK_FLASH_SIZE] = {0};
 
+uint32_t FlashEraseCount   = 0;
+uint32_t FlashProgramCount = 0;
+uint32_t FlashUnlockCount  = 0;
+
 static bool flash_locked = true;
 
 FLASH_Status FLASH_ErasePage(uint32_t Page_Address) {
+    ++FlashEraseCount;
     if (flash_locked) return FLASH_ERROR_WRP;
     Page_Address -= (uintptr_t)FlashBuf;
     Page_Address -= (Page_Address % FEE_PAGE_SIZE);
@@ -31,7 +36,7 @@ FLASH_Status FLASH_ErasePage(uint32_t Page_Address) {
     return FLASH_COMPLETE;
 }
 
-FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data) {
+static FLASH_Status program_half_word(uint32_t Address, uint16_t Data) {
     if (flash_locked) return FLASH_ERROR_WRP;
     Address -= (uintptr_t)FlashBuf;
     if (Address >= MOCK_FLASH_SIZE) return FLASH_BAD_ADDRESS;
@@ -44,10 +49,25 @@ FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data) {
     }
 }
 
+FLASH_Status FLASH_ProgramHalfWord(uint32_t Address, uint16_t Data) {
+    ++FlashProgramCount;
+    return program_half_word(Address, Data);
+}
+
+FLASH_Status FLASH_ProgramHalfWords(uint32_t Address, const uint16_t *Data, uint16_t Count) {
+    ++FlashProgramCount;
+    for (; Count; --Count, Address += 2) {
+        FLASH_Status status = program_half_word(Address, *Data++);
+        if (status != FLASH_COMPLETE) return status;
+    }
+    return FLASH_COMPLETE;
+}
+
 FLASH_Status FLASH_WaitForLastOperation(uint32_t Timeout) {
     return FLASH_COMPLETE;
 }
 void FLASH_Unlock(void) {
+    ++FlashUnlockCount;
     flash_locked = false;
 }
 void FLASH_Lock(void) {
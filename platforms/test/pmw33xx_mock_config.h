@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+typedef uint8_t pin_t;
+
+#define POINTING_DEVICE_DRIVER_pmw3360
+#define PMW33XX_CS_PINS {1, 2}
+#define PMW33XX_CS_PINS_RIGHT {1, 2}
@@ -0,0 +1,206 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "pmw33xx_common.h"
+#include "spi_master_mock.h"
+
+bool is_keyboard_left(void) {
+    return true;
+}
+}
+
+using Log = std::vector<std::string>;
+
+/* Sensor chip select pins, as configured in pmw33xx_mock_config.h */
+#define SENSOR_0 1
+#define SENSOR_1 2
+
+/* Motion burst of a moving sensor, which the driver reports as (-dx, -dy) */
+#define MOTION_BURST(motion, dx, dy) {(motion), 0x00, (uint8_t)(dx), (uint8_t)((dx) >> 8), (uint8_t)(dy), (uint8_t)((dy) >> 8)}
+
+/* Operations on the bus, e.g. "transmit 1 d0 00" for a register write to the first sensor */
+static Log spi_log(uint16_t from = 0) {
+    static const char *names[] = {"start", "write", "read", "transmit", "receive", "stop"};
+    Log                log;
+
+    for (uint16_t i = from; i < spi_mock_event_count && i < SPI_MOCK_MAX_EVENTS; i++) {
+        const spi_mock_event_t &event = spi_mock_events[i];
+        std::ostringstream      line;
+        line << names[event.op] << " " << (int)event.pin << std::hex << std::setfill('0');
+        if (event.op == SPI_MOCK_WRITE || event.op == SPI_MOCK_TRANSMIT) {
+            for (uint16_t j = 0; j < event.length && j < sizeof(event.data); j++) {
+                line << " " << std::setw(2) << (int)event.data[j];
+            }
+        } else if (event.op == SPI_MOCK_RECEIVE) {
+            line << " " << std::dec << event.length;
+        }
+        log.push_back(line.str());
+    }
+    return log;
+}
+
+static Log enter_burst_log(int pin) {
+    return {"start " + std::to_string(pin), "transmit " + std::to_string(pin) + " d0 00", "stop " + std::to_string(pin)};
+}
+
+static Log motion_burst_log(int pin) {
+    return {"start " + std::to_string(pin), "write " + std::to_string(pin) + " 50", "receive " + std::to_string(pin) + " 6", "stop " + std::to_string(pin)};
+}
+
+static Log concat(std::initializer_list<Log> logs) {
+    Log log;
+    for (const Log &part : logs) {
+        log.insert(log.end(), part.begin(), part.end());
+    }
+    return log;
+}
+
+class Pmw33xxTest : public testing::Test {
+   protected:
+    void SetUp() override {
+        /* Drop reports left over from a previous test */
+        pmw33xx_read_burst(1);
+        /* Writing any other register leaves burst mode */
+        pmw33xx_write(0, REG_Config2, 0x00);
+        pmw33xx_write(1, REG_Config2, 0x00);
+        spi_mock_reset();
+    }
+};
+
+TEST_F(Pmw33xxTest, ReadBurstEntersBurstModeOnce) {
+    pmw33xx_read_burst(0);
+    EXPECT_EQ(spi_log(), concat({enter_burst_log(SENSOR_0), motion_burst_log(SENSOR_0)}));
+
+    spi_mock_reset();
+    pmw33xx_read_burst(0);
+    EXPECT_EQ(spi_log(), motion_burst_log(SENSOR_0));
+}
+
+TEST_F(Pmw33xxTest, ReadBurstAllSensorsEntersBurstModeTogether) {
+    pmw33xx_report_t reports[2];
+    pmw33xx_read_burst_all_sensors(reports);
+    EXPECT_EQ(spi_log(), concat({enter_burst_log(SENSOR_0), enter_burst_log(SENSOR_1), motion_burst_log(SENSOR_0), motion_burst_log(SENSOR_1)}));
+
+    /* tSWR between leaving the first sensor after the write, and selecting it again for the burst */
+    EXPECT_GE(spi_mock_events[6].time_us - spi_mock_events[2].time_us, 145);
+
+    spi_mock_reset();
+    pmw33xx_read_burst_all_sensors(reports);
+    EXPECT_EQ(spi_log(), concat({motion_burst_log(SENSOR_0), motion_burst_log(SENSOR_1)}));
+}
+
+TEST_F(Pmw33xxTest, ReadBurstAllSensorsSharesTheWaitForBurstMode) {
+    pmw33xx_read_burst(0);
+    pmw33xx_read_burst(1);
+    uint32_t sequential_us = spi_mock_time_us;
+
+    SetUp();
+    pmw33xx_report_t reports[2];
+    pmw33xx_read_burst_all_sensors(reports);
+    EXPECT_EQ(spi_mock_time_us, sequential_us - 145);
+}
+
+TEST_F(Pmw33xxTest, ReadBurstAllSensorsReportsEachSensor) {
+    const uint8_t burst_0[] = MOTION_BURST(0x80, 5, -3);
+    const uint8_t burst_1[] = MOTION_BURST(0x80, -200, 1000);
+    spi_mock_set_response(SENSOR_0, burst_0, sizeof(burst_0));
+    spi_mock_set_response(SENSOR_1, burst_1, sizeof(burst_1));
+
+    pmw33xx_report_t reports[2];
+    pmw33xx_read_burst_all_sensors(reports);
+    EXPECT_TRUE(reports[0].motion.b.is_motion);
+    EXPECT_EQ(reports[0].delta_x, -5);
+    EXPECT_EQ(reports[0].delta_y, 3);
+    EXPECT_TRUE(reports[1].motion.b.is_motion);
+    EXPECT_EQ(reports[1].delta_x, 200);
+    EXPECT_EQ(reports[1].delta_y, -1000);
+}
+
+TEST_F(Pmw33xxTest, ReadBurstAllSensorsOnlyReentersLostBurstMode) {
+    pmw33xx_report_t reports[2];
+    pmw33xx_read_burst_all_sensors(reports);
+
+    /* Reserved motion bits set, the driver takes the second sensor out of burst mode */
+    const uint8_t garbage[] = MOTION_BURST(0x87, 0, 0);
+    spi_mock_set_response(SENSOR_1, garbage, sizeof(garbage));
+    pmw33xx_read_burst_all_sensors(reports);
+
+    spi_mock_reset();
+    pmw33xx_read_burst_all_sensors(reports);
+    EXPECT_EQ(spi_log(), concat({enter_burst_log(SENSOR_1), motion_burst_log(SENSOR_0), motion_burst_log(SENSOR_1)}));
+}
+
+#ifdef PMW33XX_INTERLEAVED_READ
+TEST_F(Pmw33xxTest, GetReportReadsAllSensors) {
+    const uint8_t burst_0[] = MOTION_BURST(0x80, 5, -3);
+    const uint8_t burst_1[] = MOTION_BURST(0x80, 7, 9);
+    spi_mock_set_response(SENSOR_0, burst_0, sizeof(burst_0));
+    spi_mock_set_response(SENSOR_1, burst_1, sizeof(burst_1));
+
+    report_mouse_t mouse_report = pmw33xx_get_report((report_mouse_t){});
+    EXPECT_EQ(mouse_report.x, -5);
+    EXPECT_EQ(mouse_report.y, 3);
+    EXPECT_EQ(spi_log(), concat({enter_burst_log(SENSOR_0), enter_burst_log(SENSOR_1), motion_burst_log(SENSOR_0), motion_burst_log(SENSOR_1)}));
+
+    /* The second sensor was read along with the first one */
+    spi_mock_reset();
+    pmw33xx_report_t report = pmw33xx_read_burst(1);
+    EXPECT_EQ(report.delta_x, -7);
+    EXPECT_EQ(report.delta_y, -9);
+    EXPECT_EQ(spi_log(), Log{});
+
+    /* But only once */
+    pmw33xx_read_burst(1);
+    EXPECT_EQ(spi_log(), motion_burst_log(SENSOR_1));
+}
+
+TEST_F(Pmw33xxTest, GetReportAddsUpUncollectedMotion) {
+    const uint8_t burst_1[] = MOTION_BURST(0x80, 7, 9);
+    const uint8_t still[]   = MOTION_BURST(0x00, 0, 0);
+    spi_mock_set_response(SENSOR_1, burst_1, sizeof(burst_1));
+    pmw33xx_get_report((report_mouse_t){});
+    pmw33xx_get_report((report_mouse_t){});
+    spi_mock_set_response(SENSOR_1, still, sizeof(still));
+    pmw33xx_get_report((report_mouse_t){});
+
+    pmw33xx_report_t report = pmw33xx_read_burst(1);
+    EXPECT_TRUE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, -14);
+    EXPECT_EQ(report.delta_y, -18);
+
+    /* Collecting the motion clears it */
+    pmw33xx_get_report((report_mouse_t){});
+    report = pmw33xx_read_burst(1);
+    EXPECT_FALSE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, 0);
+    EXPECT_EQ(report.delta_y, 0);
+}
+
+TEST_F(Pmw33xxTest, GetReportSaturatesUncollectedMotion) {
+    const uint8_t burst_1[] = MOTION_BURST(0x80, 30000, -30000);
+    spi_mock_set_response(SENSOR_1, burst_1, sizeof(burst_1));
+    pmw33xx_get_report((report_mouse_t){});
+    pmw33xx_get_report((report_mouse_t){});
+
+    pmw33xx_report_t report = pmw33xx_read_burst(1);
+    EXPECT_EQ(report.delta_x, INT16_MIN);
+    EXPECT_EQ(report.delta_y, INT16_MAX);
+}
+#else
+TEST_F(Pmw33xxTest, GetReportReadsFirstSensor) {
+    const uint8_t burst_0[] = MOTION_BURST(0x80, 5, -3);
+    spi_mock_set_response(SENSOR_0, burst_0, sizeof(burst_0));
+
+    report_mouse_t mouse_report = pmw33xx_get_report((report_mouse_t){});
+    EXPECT_EQ(mouse_report.x, -5);
+    EXPECT_EQ(mouse_report.y, 3);
+    EXPECT_EQ(spi_log(), concat({enter_burst_log(SENSOR_0), motion_burst_log(SENSOR_0)}));
+}
+#endif
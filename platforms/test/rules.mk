@@ -23,3 +23,22 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+pmw33xx_DEFS := -DWAIT_US_MOCKED -DNO_PRINT
+pmw33xx_interleaved_DEFS := $(pmw33xx_DEFS) -DPMW33XX_INTERLEAVED_READ
+
+pmw33xx_CONFIG := $(PLATFORM_PATH)/$(PLATFORM_KEY)/pmw33xx_mock_config.h
+pmw33xx_interleaved_CONFIG := $(pmw33xx_CONFIG)
+
+pmw33xx_INC := \
+	$(QUANTUM_PATH)/pointing_device \
+	$(DRIVER_PATH)/sensors
+pmw33xx_interleaved_INC := $(pmw33xx_INC)
+
+pmw33xx_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/spi_master_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/pmw33xx_tests.cpp \
+	$(DRIVER_PATH)/sensors/pmw33xx_common.c \
+	$(DRIVER_PATH)/sensors/pmw3360.c
+pmw33xx_interleaved_SRC := $(pmw33xx_SRC)
@@ -0,0 +1,97 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "spi_master_mock.h"
+#include "wait.h"
+
+spi_mock_event_t spi_mock_events[SPI_MOCK_MAX_EVENTS];
+uint16_t         spi_mock_event_count = 0;
+uint32_t         spi_mock_time_us     = 0;
+
+static uint8_t  responses[SPI_MOCK_MAX_DEVICES][16];
+static uint16_t response_length[SPI_MOCK_MAX_DEVICES];
+static uint16_t response_position = 0;
+static pin_t    selected_pin      = NO_PIN;
+
+static spi_mock_event_t *record(spi_mock_op_t op, uint16_t length) {
+    static spi_mock_event_t overflow;
+    spi_mock_event_t       *event = spi_mock_event_count < SPI_MOCK_MAX_EVENTS ? &spi_mock_events[spi_mock_event_count] : &overflow;
+
+    spi_mock_event_count++;
+    memset(event, 0, sizeof(*event));
+    event->op      = op;
+    event->pin     = selected_pin;
+    event->length  = length;
+    event->time_us = spi_mock_time_us;
+    return event;
+}
+
+static uint8_t next_response_byte(void) {
+    if (selected_pin >= SPI_MOCK_MAX_DEVICES || response_position >= response_length[selected_pin]) {
+        return 0;
+    }
+    return responses[selected_pin][response_position++];
+}
+
+void spi_mock_reset(void) {
+    spi_mock_event_count = 0;
+    spi_mock_time_us     = 0;
+    memset(response_length, 0, sizeof(response_length));
+}
+
+void spi_mock_set_response(pin_t pin, const uint8_t *data, uint16_t length) {
+    if (pin >= SPI_MOCK_MAX_DEVICES) {
+        return;
+    }
+    if (length > sizeof(responses[pin])) {
+        length = sizeof(responses[pin]);
+    }
+    memcpy(responses[pin], data, length);
+    response_length[pin] = length;
+}
+
+void wait_us(uint32_t us) {
+    spi_mock_time_us += us;
+}
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (selected_pin != NO_PIN) {
+        return false;
+    }
+    selected_pin      = slavePin;
+    response_position = 0;
+    record(SPI_MOCK_START, 0);
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    record(SPI_MOCK_WRITE, 1)->data[0] = data;
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_read(void) {
+    record(SPI_MOCK_READ, 1);
+    return next_response_byte();
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_mock_event_t *event = record(SPI_MOCK_TRANSMIT, length);
+    memcpy(event->data, data, length < sizeof(event->data) ? length : sizeof(event->data));
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    record(SPI_MOCK_RECEIVE, length);
+    for (uint16_t i = 0; i < length; i++) {
+        data[i] = next_response_byte();
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    record(SPI_MOCK_STOP, 0);
+    selected_pin = NO_PIN;
+}
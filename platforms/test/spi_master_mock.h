@@ -0,0 +1,50 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "spi_master.h"
+
+#ifndef SPI_MOCK_MAX_EVENTS
+#    define SPI_MOCK_MAX_EVENTS 64
+#endif
+
+#ifndef SPI_MOCK_MAX_DEVICES
+#    define SPI_MOCK_MAX_DEVICES 8
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum { SPI_MOCK_START, SPI_MOCK_WRITE, SPI_MOCK_READ, SPI_MOCK_TRANSMIT, SPI_MOCK_RECEIVE, SPI_MOCK_STOP } spi_mock_op_t;
+
+typedef struct {
+    spi_mock_op_t op;
+    pin_t         pin;     // device selected by the last spi_start()
+    uint8_t       data[4]; // bytes written, the first ones of a transmit
+    uint16_t      length;  // number of bytes written or read
+    uint32_t      time_us; // time spent in wait_us() before the operation
+} spi_mock_event_t;
+
+/* SPI operations in the order they were issued, at most SPI_MOCK_MAX_EVENTS of them */
+extern spi_mock_event_t spi_mock_events[SPI_MOCK_MAX_EVENTS];
+extern uint16_t         spi_mock_event_count;
+
+/* Total time spent in wait_us() */
+extern uint32_t spi_mock_time_us;
+
+/**
+ * @brief Clears the recorded operations, the wait time and the responses of all devices.
+ */
+void spi_mock_reset(void);
+
+/**
+ * @brief Sets the bytes a device clocks out in every transaction. Reads past them return 0.
+ */
+void spi_mock_set_response(pin_t pin, const uint8_t *data, uint16_t length);
+
+#ifdef __cplusplus
+}
+#endif
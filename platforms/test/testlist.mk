@@ -1 +1,2 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += pmw33xx pmw33xx_interleaved
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
@@ -7,6 +8,7 @@
 #include "action_util.h"
 #include "keycode.h"
 #include "keycode_config.h"
+#include "matrix.h"
 #include "quantum_keycodes.h"
 #include "timer.h"
 #include "wait.h"
@@ -132,8 +134,16 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+// Running summaries of the waiting buffer, kept up to date on enq and deq so that the common queries don't scan it
+static matrix_row_t waiting_buffer_pressed_keys[MATRIX_ROWS]  = {}; // matrix keys with a buffered press
+static matrix_row_t waiting_buffer_released_keys[MATRIX_ROWS] = {}; // matrix keys with a buffered release
+static uint8_t      waiting_buffer_num_pressed                = 0;  // buffered press events
+static uint8_t      waiting_buffer_num_repeated               = 0;  // buffered events whose key and direction were already buffered
+static uint8_t      waiting_buffer_num_off_matrix             = 0;  // buffered events of keys outside the matrix, e.g. encoders
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
 static void waiting_buffer_clear(void);
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
@@ -179,7 +189,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -323,7 +333,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     // Now that tapping_key has settled as tapped, check whether
                     // Flow Tap applies to following yet-unsettled keys.
                     uint16_t prev_time = tapping_key.event.time;
-                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
                         keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
                         if (!record->event.pressed) {
                             break;
@@ -383,7 +393,7 @@ bool process_tapping(keyrecord_t *keyp) {
                     uint8_t first_tap = waiting_buffer_find_chordal_hold_tap();
                     ac_dprintf("first_tap = %u\n", first_tap);
                     if (first_tap < WAITING_BUFFER_SIZE) {
-                        for (; waiting_buffer_tail != first_tap; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+                        for (; waiting_buffer_tail != first_tap; waiting_buffer_deq()) {
                             ac_dprintf("Processing [%u]\n", waiting_buffer_tail);
                             process_record(&waiting_buffer[waiting_buffer_tail]);
                         }
@@ -483,7 +493,7 @@ bool process_tapping(keyrecord_t *keyp) {
                                 if (waiting_buffer_tail != waiting_buffer_head && is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
                                     tapping_key = waiting_buffer[waiting_buffer_tail];
                                     // Pop tail from the queue.
-                                    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+                                    waiting_buffer_deq();
                                     debug_waiting_buffer();
                                 } else
 #    endif // CHORDAL_HOLD
@@ -650,9 +660,45 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+static bool waiting_buffer_key_in_matrix(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+/** \brief Adds a record to the running summaries of the waiting buffer. */
+static void waiting_buffer_summarize(const keyrecord_t *record) {
+    if (record->event.pressed) {
+        waiting_buffer_num_pressed++;
+    }
+
+    keypos_t key = record->event.key;
+    if (!waiting_buffer_key_in_matrix(key)) {
+        waiting_buffer_num_off_matrix++;
+        return;
+    }
+
+    matrix_row_t *keys     = record->event.pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+    matrix_row_t  col_mask = (matrix_row_t)1 << key.col;
+    if (keys[key.row] & col_mask) {
+        waiting_buffer_num_repeated++;
+    }
+    keys[key.row] |= col_mask;
+}
+
+/** \brief Rebuilds the running summaries from the records in the waiting buffer. */
+static void waiting_buffer_resummarize(void) {
+    memset(waiting_buffer_pressed_keys, 0, sizeof(waiting_buffer_pressed_keys));
+    memset(waiting_buffer_released_keys, 0, sizeof(waiting_buffer_released_keys));
+    waiting_buffer_num_pressed    = 0;
+    waiting_buffer_num_repeated   = 0;
+    waiting_buffer_num_off_matrix = 0;
+    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        waiting_buffer_summarize(&waiting_buffer[i]);
+    }
+}
+
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Appends the record to the waiting buffer. Returns false if the buffer is full.
  */
 bool waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
@@ -666,43 +712,83 @@ bool waiting_buffer_enq(keyrecord_t record) {
 
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
+    waiting_buffer_summarize(&record);
 
     ac_dprintf("waiting_buffer_enq: ");
     debug_waiting_buffer();
     return true;
 }
 
+/** \brief Waiting buffer deq
+ *
+ * Removes the record at the tail of the waiting buffer.
+ */
+void waiting_buffer_deq(void) {
+    const keyrecord_t *record = &waiting_buffer[waiting_buffer_tail];
+    waiting_buffer_tail       = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+
+    // A key whose press or release is buffered more than once may still have another one buffered
+    if (waiting_buffer_num_repeated) {
+        waiting_buffer_resummarize();
+        return;
+    }
+
+    if (record->event.pressed) {
+        waiting_buffer_num_pressed--;
+    }
+
+    keypos_t key = record->event.key;
+    if (!waiting_buffer_key_in_matrix(key)) {
+        waiting_buffer_num_off_matrix--;
+        return;
+    }
+
+    matrix_row_t *keys = record->event.pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+    keys[key.row] &= ~((matrix_row_t)1 << key.col);
+}
+
 /** \brief Waiting buffer clear
  *
- * FIXME: Needs docs
+ * Drops all records in the waiting buffer.
  */
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+    waiting_buffer_resummarize();
 }
 
-/** \brief Waiting buffer typed
- *
- * FIXME: Needs docs
- */
-bool waiting_buffer_typed(keyevent_t event) {
+/** \brief Returns true if a press or release of the key is in the waiting buffer. */
+static bool waiting_buffer_has_event(keypos_t key, bool pressed) {
+    if (waiting_buffer_key_in_matrix(key)) {
+        const matrix_row_t *keys = pressed ? waiting_buffer_pressed_keys : waiting_buffer_released_keys;
+        return (keys[key.row] >> key.col) & 1;
+    }
+
+    if (!waiting_buffer_num_off_matrix) {
+        return false;
+    }
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
+        if (KEYEQ(key, waiting_buffer[i].event.key) && pressed == waiting_buffer[i].event.pressed) {
             return true;
         }
     }
     return false;
 }
 
+/** \brief Waiting buffer typed
+ *
+ * Returns true if the opposite event of the same key, i.e. its press for a release, is in the waiting buffer.
+ */
+bool waiting_buffer_typed(keyevent_t event) {
+    return waiting_buffer_has_event(event.key, !event.pressed);
+}
+
 /** \brief Waiting buffer has anykey pressed
  *
- * FIXME: Needs docs
+ * Returns true if any press is in the waiting buffer.
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_num_pressed > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -717,6 +803,11 @@ void waiting_buffer_scan_tap(void) {
         return;
     }
 
+    // early return if the release of the tapping key isn't buffered
+    if (!waiting_buffer_has_event(tapping_key.event.key, false)) {
+        return;
+    }
+
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
@@ -968,7 +1059,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
             registered_taps_add(record->event.key);
         }
         process_record(record);
-        waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+        waiting_buffer_deq();
 
         if (KEYEQ(key, record->event.key) && record->event.pressed) {
             break;
@@ -977,7 +1068,7 @@ static void waiting_buffer_chordal_hold_taps_until(keypos_t key) {
 }
 
 static void waiting_buffer_process_regular(void) {
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (is_tap_record(&waiting_buffer[waiting_buffer_tail])) {
             break; // Stop once a tap-hold key event is reached.
         }
@@ -320,8 +320,14 @@ void send_nkro_report(void) {
 
     static report_nkro_t last_report;
 
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
+    /* Only send the report if there are changes to propagate to the host.
+     * The key bits only need comparing when keys were added or removed since the last send. */
+    bool changed = nkro_report->mods != last_report.mods;
+    if (is_nkro_report_dirty()) {
+        clear_nkro_report_dirty();
+        changed |= memcmp(nkro_report->bits, last_report.bits, sizeof(last_report.bits)) != 0;
+    }
+    if (changed) {
         memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
         host_nkro_send(nkro_report);
     }
@@ -0,0 +1,167 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+#include "wavetable_synth.h"
+}
+
+#define SAMPLE_RATE 8000
+#define CENTER 2048
+#define AMPLITUDE 2047
+
+class WavetableSynth : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        wavetable_synth_init(SAMPLE_RATE);
+    }
+
+    std::vector<uint16_t> render(size_t length) {
+        std::vector<uint16_t> buffer(length);
+        wavetable_synth_render(buffer.data(), length, CENTER, AMPLITUDE);
+        return buffer;
+    }
+
+    static size_t rising_crossings(const std::vector<uint16_t> &buffer) {
+        size_t crossings = 0;
+        for (size_t i = 1; i < buffer.size(); i++) {
+            if (buffer[i - 1] < CENTER && buffer[i] >= CENTER) {
+                crossings++;
+            }
+        }
+        return crossings;
+    }
+
+    static int peak(const std::vector<uint16_t> &buffer, size_t from, size_t to) {
+        int result = 0;
+        for (size_t i = from; i < to; i++) {
+            result = std::max(result, std::abs((int)buffer[i] - CENTER));
+        }
+        return result;
+    }
+
+    const wavetable_synth_envelope_t organ = {.attack_ms = 0, .decay_ms = 0, .sustain = 255, .release_ms = 0};
+};
+
+TEST_F(WavetableSynth, IdleRendersCenter) {
+    auto buffer = render(64);
+    for (auto sample : buffer) {
+        EXPECT_EQ(sample, CENTER);
+    }
+    EXPECT_FALSE(wavetable_synth_is_active());
+}
+
+TEST_F(WavetableSynth, PlaysRequestedFrequency) {
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(440), WAVETABLE_SYNTH_WAVEFORM_SINE, &organ);
+    auto buffer = render(SAMPLE_RATE);
+    EXPECT_NEAR(rising_crossings(buffer), 440, 1);
+}
+
+TEST_F(WavetableSynth, FractionalFrequency) {
+    // A4 one octave down plus a quarter Hz, to check the fractional part of the phase step
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(220) + (1UL << 14), WAVETABLE_SYNTH_WAVEFORM_SAWTOOTH, &organ);
+    auto buffer = render(SAMPLE_RATE * 4);
+    EXPECT_NEAR(rising_crossings(buffer), 881, 1);
+}
+
+TEST_F(WavetableSynth, FullScaleWithinAmplitude) {
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(100), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &organ);
+    auto buffer = render(SAMPLE_RATE / 10);
+    EXPECT_NEAR(peak(buffer, 0, buffer.size()), AMPLITUDE, 2);
+    for (auto sample : buffer) {
+        EXPECT_LE(sample, CENTER + AMPLITUDE);
+        EXPECT_GE(sample, CENTER - AMPLITUDE);
+    }
+}
+
+TEST_F(WavetableSynth, AttackDecaySustain) {
+    const wavetable_synth_envelope_t envelope = {.attack_ms = 10, .decay_ms = 10, .sustain = 128, .release_ms = 10};
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(1000), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &envelope);
+    // 80 samples of attack, 80 samples of decay at 8 kHz
+    auto buffer = render(400);
+    EXPECT_LT(peak(buffer, 0, 8), AMPLITUDE / 8);
+    EXPECT_NEAR(peak(buffer, 72, 88), AMPLITUDE, AMPLITUDE / 16);
+    EXPECT_NEAR(peak(buffer, 300, 400), AMPLITUDE / 2, AMPLITUDE / 32);
+    EXPECT_TRUE(wavetable_synth_voice_is_active(0));
+}
+
+TEST_F(WavetableSynth, ReleaseFadesToCenter) {
+    const wavetable_synth_envelope_t envelope = {.attack_ms = 0, .decay_ms = 0, .sustain = 255, .release_ms = 20};
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(500), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &envelope);
+    render(100);
+    wavetable_synth_note_off(0);
+    EXPECT_TRUE(wavetable_synth_is_active());
+
+    // 160 samples of release at 8 kHz
+    auto buffer = render(200);
+    EXPECT_NEAR(peak(buffer, 0, 16), AMPLITUDE, AMPLITUDE / 8);
+    EXPECT_NEAR(peak(buffer, 72, 88), AMPLITUDE / 2, AMPLITUDE / 8);
+    for (size_t i = 165; i < buffer.size(); i++) {
+        EXPECT_EQ(buffer[i], CENTER);
+    }
+    EXPECT_FALSE(wavetable_synth_is_active());
+}
+
+TEST_F(WavetableSynth, SetFrequencyKeepsEnvelope) {
+    const wavetable_synth_envelope_t envelope = {.attack_ms = 100, .decay_ms = 0, .sustain = 255, .release_ms = 0};
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(200), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &envelope);
+    auto before = render(400);
+    wavetable_synth_set_frequency(0, WAVETABLE_SYNTH_HZ(400));
+    auto after = render(400);
+    // still rising from where it was, rather than restarting from silence
+    EXPECT_GT(peak(after, 0, 40), peak(before, 360, 400) - AMPLITUDE / 32);
+    EXPECT_NEAR(rising_crossings(after), 20, 1);
+}
+
+TEST_F(WavetableSynth, MixesVoicesWithoutClipping) {
+    for (uint8_t voice = 0; voice < WAVETABLE_SYNTH_VOICES; voice++) {
+        wavetable_synth_note_on(voice, WAVETABLE_SYNTH_HZ(250), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &organ);
+    }
+    // identical voices in phase add up to exactly full scale
+    auto buffer = render(SAMPLE_RATE / 10);
+    EXPECT_NEAR(peak(buffer, 0, buffer.size()), AMPLITUDE, 2);
+    for (auto sample : buffer) {
+        EXPECT_LE(sample, CENTER + AMPLITUDE);
+        EXPECT_GE(sample, CENTER - AMPLITUDE);
+    }
+}
+
+TEST_F(WavetableSynth, ScalesWholeRangeOfAmplitudes) {
+    for (uint8_t voice = 0; voice < WAVETABLE_SYNTH_VOICES - 1; voice++) {
+        wavetable_synth_note_on(voice, WAVETABLE_SYNTH_HZ(250), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &organ);
+    }
+    // an odd number of voices at the widest and narrowest amplitudes, where the gain has the least headroom and precision
+    for (uint16_t amplitude : {32767, 1000, 1}) {
+        std::vector<uint16_t> buffer(SAMPLE_RATE / 100);
+        wavetable_synth_render(buffer.data(), buffer.size(), 32768, amplitude);
+        // the very first sample rendered is still at the start of the attack
+        for (size_t i = 1; i < buffer.size(); i++) {
+            EXPECT_NEAR(std::abs((int)buffer[i] - 32768), amplitude, 3) << "amplitude " << amplitude;
+        }
+    }
+}
+
+TEST_F(WavetableSynth, MixContainsBothVoices) {
+    wavetable_synth_note_on(0, WAVETABLE_SYNTH_HZ(100), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &organ);
+    wavetable_synth_note_on(1, WAVETABLE_SYNTH_HZ(1000), WAVETABLE_SYNTH_WAVEFORM_SQUARE, &organ);
+    auto buffer = render(SAMPLE_RATE / 10);
+    // the sum of two squares is at full scale while they agree, and cancels out at center half of the time
+    size_t near_center = 0;
+    for (auto sample : buffer) {
+        if (std::abs((int)sample - CENTER) <= 1) {
+            near_center++;
+        }
+    }
+    EXPECT_NEAR(peak(buffer, 0, buffer.size()), AMPLITUDE, 2);
+    EXPECT_NEAR(near_center, buffer.size() / 2, buffer.size() / 50);
+}
+
+TEST_F(WavetableSynth, IgnoresInvalidVoice) {
+    wavetable_synth_note_on(WAVETABLE_SYNTH_VOICES, WAVETABLE_SYNTH_HZ(440), WAVETABLE_SYNTH_WAVEFORM_SINE, &organ);
+    EXPECT_FALSE(wavetable_synth_is_active());
+    EXPECT_FALSE(wavetable_synth_voice_is_active(WAVETABLE_SYNTH_VOICES));
+}
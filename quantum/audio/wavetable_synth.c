@@ -0,0 +1,195 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "wavetable_synth.h"
+
+// Envelope levels are Q8.24, so that slow envelopes at high sample rates still have a non-zero step
+#define ENVELOPE_MAX (1UL << 24)
+
+typedef enum {
+    ENVELOPE_IDLE,
+    ENVELOPE_ATTACK,
+    ENVELOPE_DECAY,
+    ENVELOPE_SUSTAIN,
+    ENVELOPE_RELEASE,
+} envelope_stage_t;
+
+typedef struct {
+    uint32_t                   phase;
+    uint32_t                   phase_step;
+    uint32_t                   level;
+    uint32_t                   attack_step;
+    uint32_t                   decay_step;
+    uint32_t                   sustain_level;
+    uint32_t                   release_step;
+    uint16_t                   release_ms;
+    envelope_stage_t           stage;
+    wavetable_synth_waveform_t waveform;
+} synth_voice_t;
+
+// One full period of a sine wave
+static const int16_t sine_table[256] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530, 18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285, 32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+    30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+    12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179, 6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+    0, -804, -1608, -2410, -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+};
+
+static synth_voice_t voices[WAVETABLE_SYNTH_VOICES];
+static uint32_t      synth_sample_rate = 1;
+
+void wavetable_synth_init(uint32_t sample_rate) {
+    synth_sample_rate = sample_rate;
+    for (uint8_t i = 0; i < WAVETABLE_SYNTH_VOICES; i++) {
+        voices[i].stage = ENVELOPE_IDLE;
+        voices[i].level = 0;
+    }
+}
+
+static uint32_t ms_to_samples(uint16_t ms) {
+    uint32_t samples = ((uint64_t)ms * synth_sample_rate) / 1000;
+    return samples > 0 ? samples : 1;
+}
+
+// The phase wraps around once per period, so one sample advances it by frequency / sample rate of 2^32
+static uint32_t frequency_to_phase_step(uint32_t frequency) {
+    return ((uint64_t)frequency << 16) / synth_sample_rate;
+}
+
+void wavetable_synth_note_on(uint8_t voice, uint32_t frequency, wavetable_synth_waveform_t waveform, const wavetable_synth_envelope_t *envelope) {
+    if (voice >= WAVETABLE_SYNTH_VOICES) return;
+    synth_voice_t *v = &voices[voice];
+
+    v->phase         = 0;
+    v->phase_step    = frequency_to_phase_step(frequency);
+    v->waveform      = waveform;
+    v->level         = 0;
+    v->sustain_level = (uint32_t)envelope->sustain * (ENVELOPE_MAX / 255);
+    v->attack_step   = ENVELOPE_MAX / ms_to_samples(envelope->attack_ms);
+    v->decay_step    = (ENVELOPE_MAX - v->sustain_level) / ms_to_samples(envelope->decay_ms);
+    v->release_ms    = envelope->release_ms;
+    v->stage         = ENVELOPE_ATTACK;
+}
+
+void wavetable_synth_set_frequency(uint8_t voice, uint32_t frequency) {
+    if (voice >= WAVETABLE_SYNTH_VOICES) return;
+    voices[voice].phase_step = frequency_to_phase_step(frequency);
+}
+
+void wavetable_synth_note_off(uint8_t voice) {
+    if (voice >= WAVETABLE_SYNTH_VOICES) return;
+    synth_voice_t *v = &voices[voice];
+    if (v->stage == ENVELOPE_IDLE || v->stage == ENVELOPE_RELEASE) return;
+
+    // Fade out from wherever the envelope currently is
+    v->release_step = v->level / ms_to_samples(v->release_ms);
+    if (v->release_step == 0) v->release_step = 1;
+    v->stage = ENVELOPE_RELEASE;
+}
+
+bool wavetable_synth_voice_is_active(uint8_t voice) {
+    return voice < WAVETABLE_SYNTH_VOICES && voices[voice].stage != ENVELOPE_IDLE;
+}
+
+bool wavetable_synth_is_active(void) {
+    for (uint8_t i = 0; i < WAVETABLE_SYNTH_VOICES; i++) {
+        if (voices[i].stage != ENVELOPE_IDLE) return true;
+    }
+    return false;
+}
+
+static inline int16_t waveform_sample(wavetable_synth_waveform_t waveform, uint32_t phase) {
+    switch (waveform) {
+        case WAVETABLE_SYNTH_WAVEFORM_TRIANGLE: {
+            int32_t position = phase >> 16;
+            return (position < 0x8000 ? position : 0xFFFF - position) * 2 - 32767;
+        }
+        case WAVETABLE_SYNTH_WAVEFORM_SQUARE:
+            return phase < 0x80000000UL ? 32767 : -32767;
+        case WAVETABLE_SYNTH_WAVEFORM_SAWTOOTH:
+            return (int32_t)(phase >> 16) - 32768;
+        default:
+            return sine_table[phase >> 24];
+    }
+}
+
+static inline void envelope_step(synth_voice_t *v) {
+    switch (v->stage) {
+        case ENVELOPE_ATTACK:
+            if (ENVELOPE_MAX - v->level <= v->attack_step) {
+                v->level = ENVELOPE_MAX;
+                v->stage = ENVELOPE_DECAY;
+            } else {
+                v->level += v->attack_step;
+            }
+            break;
+        case ENVELOPE_DECAY:
+            if (v->level - v->sustain_level <= v->decay_step) {
+                v->level = v->sustain_level;
+                v->stage = ENVELOPE_SUSTAIN;
+            } else {
+                v->level -= v->decay_step;
+            }
+            break;
+        case ENVELOPE_RELEASE:
+            if (v->level <= v->release_step) {
+                v->level = 0;
+                v->stage = ENVELOPE_IDLE;
+            } else {
+                v->level -= v->release_step;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void wavetable_synth_render(uint16_t *buffer, size_t length, uint16_t center, uint16_t amplitude) {
+    synth_voice_t *active[WAVETABLE_SYNTH_VOICES];
+    uint8_t        active_count = 0;
+    for (uint8_t i = 0; i < WAVETABLE_SYNTH_VOICES; i++) {
+        if (voices[i].stage != ENVELOPE_IDLE) {
+            active[active_count++] = &voices[i];
+        }
+    }
+
+    if (active_count == 0) {
+        for (size_t s = 0; s < length; s++) {
+            buffer[s] = center;
+        }
+        return;
+    }
+
+    /* Scale the output once per buffer rather than dividing every sample. Each voice adds less than 2^15 to the
+     * mix, so with the gain shifted up until amplitude << shift reaches 2^16 the product still fits 32 bits, which
+     * spares the MCUs without a 64-bit multiply instruction a library call per sample. */
+    uint8_t shift = 0;
+    while (shift < 15 && ((uint32_t)amplitude << (shift + 1)) <= UINT16_MAX) {
+        shift++;
+    }
+    int32_t gain = ((int32_t)amplitude << shift) / active_count;
+
+    for (size_t s = 0; s < length; s++) {
+        int32_t mix = 0;
+        for (uint8_t i = 0; i < active_count; i++) {
+            synth_voice_t *v = active[i];
+            // Q15 sample times Q15 envelope level
+            mix += ((int32_t)waveform_sample(v->waveform, v->phase) * (int32_t)(v->level >> 9)) >> 15;
+            v->phase += v->phase_step;
+            envelope_step(v);
+        }
+        buffer[s] = center + ((mix * gain) >> (15 + shift));
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * \file
+ *
+ * \brief Integer-only wavetable synthesizer.
+ *
+ * Every voice has a 32-bit phase accumulator, a waveform and an ADSR envelope.
+ * Frequencies are given in Q16.16 Hz, so note on and off are the only places
+ * where anything gets divided; rendering a buffer only adds, shifts and
+ * multiplies, which keeps it cheap on MCUs without an FPU.
+ */
+
+/** \brief Number of voices that can sound at the same time. */
+#ifndef WAVETABLE_SYNTH_VOICES
+#    define WAVETABLE_SYNTH_VOICES 8
+#endif
+
+/** \brief Converts a frequency in Hz to the Q16.16 format used by the synthesizer. */
+#define WAVETABLE_SYNTH_HZ(hz) ((uint32_t)((hz) * 65536UL))
+
+typedef enum {
+    WAVETABLE_SYNTH_WAVEFORM_SINE,
+    WAVETABLE_SYNTH_WAVEFORM_TRIANGLE,
+    WAVETABLE_SYNTH_WAVEFORM_SQUARE,
+    WAVETABLE_SYNTH_WAVEFORM_SAWTOOTH,
+} wavetable_synth_waveform_t;
+
+typedef struct {
+    uint16_t attack_ms;  // time to rise from silence to full level
+    uint16_t decay_ms;   // time to fall from full level to the sustain level
+    uint8_t  sustain;    // level held while the note is on, 255 being full level
+    uint16_t release_ms; // time to fall from the current level to silence after note off
+} wavetable_synth_envelope_t;
+
+/**
+ * \brief Silences every voice and sets the rate that buffers are rendered at.
+ */
+void wavetable_synth_init(uint32_t sample_rate);
+
+/**
+ * \brief Starts a note on a voice, restarting its phase and envelope.
+ *
+ * \param voice the voice to play the note on
+ * \param frequency the frequency of the note, in Q16.16 Hz
+ * \param waveform the waveform of the voice
+ * \param envelope the envelope of the note
+ */
+void wavetable_synth_note_on(uint8_t voice, uint32_t frequency, wavetable_synth_waveform_t waveform, const wavetable_synth_envelope_t *envelope);
+
+/**
+ * \brief Changes the frequency of a voice without restarting its envelope, e.g. for vibrato.
+ */
+void wavetable_synth_set_frequency(uint8_t voice, uint32_t frequency);
+
+/**
+ * \brief Releases the note on a voice, which fades out over the release time of its envelope.
+ */
+void wavetable_synth_note_off(uint8_t voice);
+
+/**
+ * \brief Checks whether a voice is playing, including while it is being released.
+ */
+bool wavetable_synth_voice_is_active(uint8_t voice);
+
+/**
+ * \brief Checks whether any voice is playing.
+ */
+bool wavetable_synth_is_active(void);
+
+/**
+ * \brief Renders the mix of all voices.
+ *
+ * The mix is divided by the number of voices playing at the start of the
+ * buffer, so that it never exceeds full scale.
+ *
+ * \param buffer where to write the samples
+ * \param length the number of samples to render
+ * \param center the sample value for silence
+ * \param amplitude the distance from center of a full scale sample, at most 32767
+ */
+void wavetable_synth_render(uint16_t *buffer, size_t length, uint16_t center, uint16_t amplitude);
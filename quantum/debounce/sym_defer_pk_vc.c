@@ -0,0 +1,172 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// Symmetric per-key algorithm using vertical counters. Behaves exactly like
+// sym_defer_pk, but the per-key counters are stored as bit-planes parallel to
+// matrix_row_t, so a whole row is updated with a handful of word-wide logic
+// operations instead of a loop over every column.
+// When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+
+#include "debounce.h"
+#include "timer.h"
+#include "util.h"
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+// Enough bit-planes to hold DEBOUNCE, the largest elapsed time added in one update
+#    if DEBOUNCE < 2
+#        define DEBOUNCE_COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define DEBOUNCE_COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define DEBOUNCE_COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define DEBOUNCE_COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define DEBOUNCE_COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define DEBOUNCE_COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define DEBOUNCE_COUNTER_BITS 7
+#    else
+#        define DEBOUNCE_COUNTER_BITS 8
+#    endif
+
+// Uses MATRIX_ROWS_PER_HAND instead of MATRIX_ROWS to support split keyboards
+// Bit n of counter_planes[row][b] is bit b of the elapsed time counted for column n
+static matrix_row_t counter_planes[MATRIX_ROWS_PER_HAND][DEBOUNCE_COUNTER_BITS];
+// Keys whose debounce counter is running
+static matrix_row_t counters_running[MATRIX_ROWS_PER_HAND];
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static inline void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time);
+static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[]);
+
+void debounce_init(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+    static fast_timer_t last_time;
+    bool                updated_last = false;
+    cooked_changed                   = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+
+        if (elapsed_time > 0) {
+            // Anything at or above DEBOUNCE expires, so the elapsed time can be clamped to it
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, MIN(elapsed_time, DEBOUNCE));
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked);
+    }
+
+    return cooked_changed;
+}
+
+/**
+ * @brief Adds the elapsed time to every running counter and transfers the keys whose debounce period has expired.
+ *
+ * The elapsed time is added to all running counters of a row at once with a bit-sliced ripple-carry adder.
+ * A counter has expired when the addition carries out of the top bit-plane or when the sum is at least
+ * DEBOUNCE, which is evaluated with a bit-sliced comparison from the most significant plane down.
+ *
+ * @param raw The current raw key state matrix.
+ * @param cooked The debounced key state matrix to be updated.
+ * @param elapsed_time The time elapsed since the last debounce update, in milliseconds, at most DEBOUNCE.
+ */
+static inline void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        matrix_row_t running = counters_running[row];
+        if (!running) {
+            continue;
+        }
+
+        matrix_row_t *planes = counter_planes[row];
+        matrix_row_t  carry  = 0;
+        for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+            matrix_row_t addend = (elapsed_time & (1 << bit)) ? running : 0;
+            matrix_row_t plane  = planes[bit];
+            planes[bit]         = plane ^ addend ^ carry;
+            carry               = (plane & addend) | (carry & (plane ^ addend));
+        }
+
+        matrix_row_t greater = carry;
+        matrix_row_t equal   = ~carry;
+        for (int8_t bit = DEBOUNCE_COUNTER_BITS - 1; bit >= 0; bit--) {
+            if (DEBOUNCE & (1 << bit)) {
+                equal &= planes[bit];
+            } else {
+                greater |= equal & planes[bit];
+                equal &= ~planes[bit];
+            }
+        }
+
+        matrix_row_t expired = (greater | equal) & running;
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+
+            running &= ~expired;
+            for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+                planes[bit] &= running;
+            }
+            counters_running[row] = running;
+        }
+
+        if (running) {
+            counters_need_update = true;
+        }
+    }
+}
+
+/**
+ * @brief Starts debounce counters for keys with changed states.
+ *
+ * Keys whose raw state differs from the debounced state start counting from zero unless their counter is already
+ * running. Counters of keys whose raw state matches the debounced state again are stopped and cleared.
+ *
+ * @param raw The current raw key state matrix.
+ * @param cooked The debounced key state matrix.
+ */
+static inline void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[]) {
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+
+        if (counters_running[row] & ~delta) {
+            for (uint8_t bit = 0; bit < DEBOUNCE_COUNTER_BITS; bit++) {
+                counter_planes[row][bit] &= delta;
+            }
+        }
+
+        counters_running[row] = delta;
+        if (delta) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
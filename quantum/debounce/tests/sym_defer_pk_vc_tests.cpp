@@ -0,0 +1,39 @@
+/* Copyright 2026 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* Keys of one row share vertical counters, so each must still settle on its own timeline */
+TEST_F(DebounceTest, RowStaggered) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}}, {}},
+        {2, {{0, 3, DOWN}, {0, 9, DOWN}}, {}},
+        {4, {{0, 0, DOWN}}, {}},
+
+        {5, {}, {{0, 1, DOWN}}},
+        {7, {}, {{0, 3, DOWN}, {0, 9, DOWN}}},
+        /* Bounce on one key of the row doesn't affect the others */
+        {8, {{0, 3, UP}}, {}},
+        {9, {{0, 3, DOWN}, {0, 0, UP}}, {}},
+
+        {14, {{0, 1, UP}}, {}},
+        {19, {}, {{0, 1, UP}}},
+    });
+    runEvents();
+}
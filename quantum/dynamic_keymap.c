@@ -21,6 +21,7 @@
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
+#include "compiler_support.h"
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -32,6 +33,17 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// Number of bytes fetched from NVM at a time while reading macros
+#ifndef DYNAMIC_KEYMAP_MACRO_READ_CHUNK
+#    define DYNAMIC_KEYMAP_MACRO_READ_CHUNK 16
+#endif
+
+STATIC_ASSERT(DYNAMIC_KEYMAP_MACRO_READ_CHUNK > 0 && DYNAMIC_KEYMAP_MACRO_READ_CHUNK <= 255, "DYNAMIC_KEYMAP_MACRO_READ_CHUNK must be between 1 and 255");
+
+// Start of each macro within the buffer, built on first use and dropped whenever the buffer changes
+static uint16_t macro_offsets[DYNAMIC_KEYMAP_MACRO_COUNT];
+static bool     macro_offsets_valid = false;
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -111,6 +123,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    macro_offsets_valid = false;
     nvm_dynamic_keymap_macro_update_buffer(offset, size, data);
 }
 
@@ -122,16 +135,46 @@ static uint8_t dynamic_keymap_read_byte(uint32_t offset) {
 
 typedef struct send_string_nvm_state_t {
     uint32_t offset;
+    uint32_t chunk_offset;
+    uint8_t  chunk_length;
+    uint8_t  chunk[DYNAMIC_KEYMAP_MACRO_READ_CHUNK];
 } send_string_nvm_state_t;
 
+// Reads sequentially through the macro buffer, DYNAMIC_KEYMAP_MACRO_READ_CHUNK bytes at a time
 char send_string_get_next_nvm(void *arg) {
     send_string_nvm_state_t *state = (send_string_nvm_state_t *)arg;
-    char                     ret   = dynamic_keymap_read_byte(state->offset);
+    if (state->offset - state->chunk_offset >= state->chunk_length) {
+        nvm_dynamic_keymap_macro_read_buffer(state->offset, sizeof(state->chunk), state->chunk);
+        state->chunk_offset = state->offset;
+        state->chunk_length = sizeof(state->chunk);
+    }
+    char ret = state->chunk[state->offset - state->chunk_offset];
     state->offset++;
     return ret;
 }
 
+static void dynamic_keymap_macro_build_index(void) {
+    send_string_nvm_state_t state = {.offset = 0};
+    uint32_t                end   = nvm_dynamic_keymap_macro_size();
+    uint8_t                 id    = 0;
+
+    // Macro N starts after the Nth null character
+    macro_offsets[id++] = 0;
+    while (id < DYNAMIC_KEYMAP_MACRO_COUNT && state.offset < end) {
+        if (send_string_get_next_nvm(&state) == 0) {
+            macro_offsets[id++] = state.offset;
+        }
+    }
+    // Anything not found isn't in the buffer
+    while (id < DYNAMIC_KEYMAP_MACRO_COUNT) {
+        macro_offsets[id++] = UINT16_MAX;
+    }
+
+    macro_offsets_valid = true;
+}
+
 void dynamic_keymap_macro_reset(void) {
+    macro_offsets_valid = false;
     // Erase the macros, if necessary.
     nvm_dynamic_keymap_macro_erase();
     nvm_dynamic_keymap_macro_reset();
@@ -150,22 +193,16 @@ void dynamic_keymap_macro_send(uint8_t id) {
         return;
     }
 
-    // Skip N null characters
-    // p will then point to the Nth macro
-    uint32_t offset = 0;
-    uint32_t end    = nvm_dynamic_keymap_macro_size();
-    while (id > 0) {
-        // If we are past the end of the buffer, then there is
-        // no Nth macro in the buffer.
-        if (offset == end) {
-            return;
-        }
-        if (dynamic_keymap_read_byte(offset) == 0) {
-            --id;
-        }
-        ++offset;
+    if (!macro_offsets_valid) {
+        dynamic_keymap_macro_build_index();
+    }
+
+    // If there are fewer than N null characters, then there is
+    // no Nth macro in the buffer.
+    if (macro_offsets[id] == UINT16_MAX) {
+        return;
     }
 
-    send_string_nvm_state_t state = {.offset = offset};
+    send_string_nvm_state_t state = {.offset = macro_offsets[id]};
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
 }
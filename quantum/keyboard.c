@@ -142,6 +142,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    include "matrix_telemetry.h"
+#endif
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
@@ -151,6 +154,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+#    include "send_string.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -704,6 +710,10 @@ void quantum_task(void) {
     layer_lock_task();
 #endif
 
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+    send_string_task();
+#endif
+
     host_task();
 }
 
@@ -797,6 +807,10 @@ void keyboard_task(void) {
     haptic_task();
 #endif
 
+#ifdef MATRIX_TELEMETRY_ENABLE
+    matrix_telemetry_task();
+#endif
+
     led_task();
 
 #ifdef OS_DETECTION_ENABLE
@@ -14,8 +14,10 @@
 
 #include "keycode_string.h"
 
+#include <stdbool.h>
 #include <string.h>
 #include "bitwise.h"
+#include "debug.h"
 #include "keycode.h"
 #include "progmem.h"
 #include "quantum_keycodes.h"
@@ -39,6 +41,10 @@ typedef int_fast8_t index_t;
  *
  * To save memory, feature-specific key entries are ifdef'd to include them only
  * when their feature is enabled.
+ *
+ * Entries are sorted by keycode, as they are found by binary search. This is
+ * checked on first use, see `keycode_string_common_names_sorted()`, and the
+ * table is scanned instead if it isn't.
  */
 static const uint16_t common_names[] PROGMEM = {
     KC_TRNS, KEYCODE_NAME7('K', 'C', '_', 'T', 'R', 'N', 'S'),
@@ -73,70 +79,70 @@ static const uint16_t common_names[] PROGMEM = {
     KC_DOWN, KEYCODE_NAME7('K', 'C', '_', 'D', 'O', 'W', 'N'),
     KC_UP  , KEYCODE_NAME7('K', 'C', '_', 'U', 'P',  0 ,  0 ),
     KC_NUBS, KEYCODE_NAME7('K', 'C', '_', 'N', 'U', 'B', 'S'),
-    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
-    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
 #ifdef EXTRAKEY_ENABLE
+    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
+    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
+    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
+    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
+    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
+    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
     KC_WHOM, KEYCODE_NAME7('K', 'C', '_', 'W', 'H', 'O', 'M'),
     KC_WBAK, KEYCODE_NAME7('K', 'C', '_', 'W', 'B', 'A', 'K'),
     KC_WFWD, KEYCODE_NAME7('K', 'C', '_', 'W', 'F', 'W', 'D'),
     KC_WSTP, KEYCODE_NAME7('K', 'C', '_', 'W', 'S', 'T', 'P'),
     KC_WREF, KEYCODE_NAME7('K', 'C', '_', 'W', 'R', 'E', 'F'),
-    KC_MNXT, KEYCODE_NAME7('K', 'C', '_', 'M', 'N', 'X', 'T'),
-    KC_MPRV, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'R', 'V'),
-    KC_MPLY, KEYCODE_NAME7('K', 'C', '_', 'M', 'P', 'L', 'Y'),
-    KC_MUTE, KEYCODE_NAME7('K', 'C', '_', 'M', 'U', 'T', 'E'),
-    KC_VOLU, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'U'),
-    KC_VOLD, KEYCODE_NAME7('K', 'C', '_', 'V', 'O', 'L', 'D'),
 #endif // EXTRAKEY_ENABLE
 #ifdef MOUSEKEY_ENABLE
-    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
-    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_UP  , KEYCODE_NAME7('M', 'S', '_', 'U', 'P',  0 ,  0 ),
     MS_DOWN, KEYCODE_NAME7('M', 'S', '_', 'D', 'O', 'W', 'N'),
-    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
-    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
+    MS_LEFT, KEYCODE_NAME7('M', 'S', '_', 'L', 'E', 'F', 'T'),
+    MS_RGHT, KEYCODE_NAME7('M', 'S', '_', 'R', 'G', 'H', 'T'),
     MS_WHLU, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'U'),
     MS_WHLD, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'D'),
+    MS_WHLL, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'L'),
+    MS_WHLR, KEYCODE_NAME7('M', 'S', '_', 'W', 'H', 'L', 'R'),
 #endif // MOUSEKEY_ENABLE
+    KC_MEH , KEYCODE_NAME7('K', 'C', '_', 'M', 'E', 'H',  0 ),
+    KC_HYPR, KEYCODE_NAME7('K', 'C', '_', 'H', 'Y', 'P', 'R'),
 #ifdef SWAP_HANDS_ENABLE
-    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
-    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
-    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
-    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
     SH_TOGG, KEYCODE_NAME7('S', 'H', '_', 'T', 'O', 'G', 'G'),
     SH_TT  , KEYCODE_NAME7('S', 'H', '_', 'T', 'T',  0 ,  0 ),
+    SH_MON , KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'N',  0 ),
+    SH_MOFF, KEYCODE_NAME7('S', 'H', '_', 'M', 'O', 'F', 'F'),
+    SH_OFF , KEYCODE_NAME7('S', 'H', '_', 'O', 'F', 'F',  0 ),
+    SH_ON  , KEYCODE_NAME7('S', 'H', '_', 'O', 'N',  0 ,  0 ),
 #    if !defined(NO_ACTION_ONESHOT)
     SH_OS  , KEYCODE_NAME7('S', 'H', '_', 'O', 'S',  0 ,  0 ),
 #    endif // !defined(NO_ACTION_ONESHOT)
 #endif // SWAP_HANDS_ENABLE
+    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
+    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
+    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
+#ifdef GRAVE_ESC_ENABLE
+    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
+#endif // GRAVE_ESC_ENABLE
 #ifdef LEADER_ENABLE
     QK_LEAD, KEYCODE_NAME7('Q', 'K', '_', 'L', 'E', 'A', 'D'),
 #endif // LEADER_ENABLE
 #ifdef KEY_LOCK_ENABLE
     QK_LOCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'O', 'C', 'K'),
 #endif // KEY_LOCK_ENABLE
-#ifdef TRI_LAYER_ENABLE
-    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
-    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
-#endif // TRI_LAYER_ENABLE
-#ifdef GRAVE_ESC_ENABLE
-    QK_GESC, KEYCODE_NAME7('Q', 'K', '_', 'G', 'E', 'S', 'C'),
-#endif // GRAVE_ESC_ENABLE
-#ifdef CAPS_WORD_ENABLE
-    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
-#endif // CAPS_WORD_ENABLE
 #ifdef SECURE_ENABLE
     SE_LOCK, KEYCODE_NAME7('S', 'E', '_', 'L', 'O', 'C', 'K'),
     SE_UNLK, KEYCODE_NAME7('S', 'E', '_', 'U', 'N', 'L', 'K'),
     SE_TOGG, KEYCODE_NAME7('S', 'E', '_', 'T', 'O', 'G', 'G'),
     SE_REQ , KEYCODE_NAME7('S', 'E', '_', 'R', 'E', 'Q',  0 ),
 #endif // SECURE_ENABLE
+#ifdef CAPS_WORD_ENABLE
+    CW_TOGG, KEYCODE_NAME7('C', 'W', '_', 'T', 'O', 'G', 'G'),
+#endif // CAPS_WORD_ENABLE
+#ifdef TRI_LAYER_ENABLE
+    TL_LOWR, KEYCODE_NAME7('T', 'L', '_', 'L', 'O', 'W', 'R'),
+    TL_UPPR, KEYCODE_NAME7('T', 'L', '_', 'U', 'P', 'P', 'R'),
+#endif // TRI_LAYER_ENABLE
 #ifdef LAYER_LOCK_ENABLE
     QK_LLCK, KEYCODE_NAME7('Q', 'K', '_', 'L', 'L', 'C', 'K'),
 #endif // LAYER_LOCK_ENABLE
-    EE_CLR , KEYCODE_NAME7('E', 'E', '_', 'C', 'L', 'R',  0 ),
-    QK_BOOT, KEYCODE_NAME7('Q', 'K', '_', 'B', 'O', 'O', 'T'),
-    DB_TOGG, KEYCODE_NAME7('D', 'B', '_', 'T', 'O', 'G', 'G'),
 };
 // clang-format on
 
@@ -153,44 +159,119 @@ static char buffer[32];
 #define BUFFER_MAX_LEN (sizeof(buffer) - 1)
 static index_t buffer_len;
 
+/** Whether a custom names table is sorted by keycode, found on first use. */
+typedef struct {
+    const keycode_string_name_t* data;
+    bool                         sorted;
+} table_order_t;
+
+static table_order_t user_table_order;
+static table_order_t kb_table_order;
+
+bool keycode_string_common_names_sorted(void) {
+    static bool checked = false;
+    static bool sorted  = true;
+
+    if (!checked) {
+        checked = true;
+        for (uint16_t i = 4; i < ARRAY_SIZE(common_names); i += 4) {
+            if (pgm_read_word(common_names + i - 4) >= pgm_read_word(common_names + i)) {
+                dprintf("keycode_string: common_names not sorted at entry %u\n", i / 4);
+                sorted = false;
+                break;
+            }
+        }
+    }
+    return sorted;
+}
+
 /** Finds the name of a keycode in `common_names` or returns NULL. */
 static const char* search_common_names(uint16_t keycode) {
-    static uint8_t buffer[8];
-
-    for (int_fast16_t offset = 0; offset < ARRAY_SIZE(common_names); offset += 4) {
-        if (keycode == pgm_read_word(common_names + offset)) {
-            const uint16_t w0 = pgm_read_word(common_names + offset + 1);
-            const uint16_t w1 = pgm_read_word(common_names + offset + 2);
-            const uint16_t w2 = pgm_read_word(common_names + offset + 3);
-            buffer[0]         = (uint8_t)w0;
-            buffer[1]         = (uint8_t)(w0 >> 8);
-            buffer[2]         = '_';
-            buffer[3]         = (uint8_t)w1;
-            buffer[4]         = (uint8_t)(w1 >> 8);
-            buffer[5]         = (uint8_t)w2;
-            buffer[6]         = (uint8_t)(w2 >> 8);
-            buffer[7]         = 0;
-            return (const char*)buffer;
+    static uint8_t     buffer[8];
+    const int_fast16_t size = ARRAY_SIZE(common_names) / 4;
+    int_fast16_t       i    = 0;
+
+    // Each entry is 4 words long.
+    if (keycode_string_common_names_sorted()) {
+        int_fast16_t hi = size;
+        while (i < hi) {
+            const int_fast16_t mid = (i + hi) / 2;
+            if (pgm_read_word(common_names + 4 * mid) < keycode) {
+                i = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    } else {
+        while (i < size && pgm_read_word(common_names + 4 * i) != keycode) {
+            ++i;
         }
     }
 
-    return NULL;
+    if (i >= size || pgm_read_word(common_names + 4 * i) != keycode) {
+        return NULL;
+    }
+
+    const uint16_t w0 = pgm_read_word(common_names + 4 * i + 1);
+    const uint16_t w1 = pgm_read_word(common_names + 4 * i + 2);
+    const uint16_t w2 = pgm_read_word(common_names + 4 * i + 3);
+    buffer[0]         = (uint8_t)w0;
+    buffer[1]         = (uint8_t)(w0 >> 8);
+    buffer[2]         = '_';
+    buffer[3]         = (uint8_t)w1;
+    buffer[4]         = (uint8_t)(w1 >> 8);
+    buffer[5]         = (uint8_t)w2;
+    buffer[6]         = (uint8_t)(w2 >> 8);
+    buffer[7]         = 0;
+    return (const char*)buffer;
 }
 
 /**
  * @brief Finds the name of a keycode in table or returns NULL.
  *
+ * Tables sorted by keycode are binary searched, others are scanned. Either way,
+ * the first entry for the keycode wins.
+ *
  * @param data   Pointer to table to be searched.
  * @param size   Numer of entries in the table.
+ * @param order  Whether the table is sorted, updated when `data` changes.
  * @return Name string for the keycode, or NULL if not found.
  */
-static const char* search_table(const keycode_string_name_t* data, uint16_t size, uint16_t keycode) {
-    if (data != NULL) {
-        for (uint16_t i = 0; i < size; ++i) {
-            if (data[i].keycode == keycode) {
-                return data[i].name;
+static const char* search_table(const keycode_string_name_t* data, uint16_t size, uint16_t keycode, table_order_t* order) {
+    if (data == NULL || size == 0) {
+        return NULL;
+    }
+
+    if (order->data != data) {
+        order->data   = data;
+        order->sorted = true;
+        for (uint16_t i = 1; i < size; ++i) {
+            if (data[i - 1].keycode > data[i].keycode) {
+                order->sorted = false;
+                break;
+            }
+        }
+    }
+
+    if (order->sorted) {
+        // Lower bound, so that the first of several entries for a keycode wins.
+        uint16_t lo = 0;
+        uint16_t hi = size;
+        while (lo < hi) {
+            const uint16_t mid = lo + (hi - lo) / 2;
+            if (data[mid].keycode < keycode) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
             }
         }
+        return (lo < size && data[lo].keycode == keycode) ? data[lo].name : NULL;
+    }
+
+    for (uint16_t i = 0; i < size; ++i) {
+        if (data[i].keycode == keycode) {
+            return data[i].name;
+        }
     }
     return NULL;
 }
@@ -289,12 +370,12 @@ static void append_numbered_keycode(const char* name, uint16_t number) {
 static void append_keycode(uint16_t keycode) {
     // In case there is overlap among tables, search `keycode_string_names_user`
     // first so that it takes precedence.
-    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, keycode);
+    const char* keycode_name = search_table(keycode_string_names_data_user, keycode_string_names_size_user, keycode, &user_table_order);
     if (keycode_name) {
         append(keycode_name);
         return;
     }
-    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, keycode);
+    keycode_name = search_table(keycode_string_names_data_kb, keycode_string_names_size_kb, keycode, &kb_table_order);
     if (keycode_name) {
         append(keycode_name);
         return;
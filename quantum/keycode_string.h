@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #if KEYCODE_STRING_ENABLE
 
@@ -93,6 +94,9 @@ typedef struct {
  *
  * The above defines names for `MYMACRO1` and `MYMACRO2`, and overrides
  * `KC_EXLM` to format as "KC_EXLM" instead of the default "S(KC_1)".
+ *
+ * Tables listed in ascending keycode order are binary searched, others are
+ * scanned from the start.
  */
 #    define KEYCODE_STRING_NAMES_USER(...)                                          \
     static const keycode_string_name_t keycode_string_names_user[] = {__VA_ARGS__}; \
@@ -114,6 +118,14 @@ typedef struct {
         { (kc), #kc }
 // clang-format on
 
+/**
+ * @brief Checks that the built-in names are sorted by keycode.
+ *
+ * They are binary searched if so, and scanned otherwise, which is slower and
+ * printed to the debug console. Checked once, on first use.
+ */
+bool keycode_string_common_names_sorted(void);
+
 extern const keycode_string_name_t* keycode_string_names_data_user;
 extern uint16_t                     keycode_string_names_size_user;
 extern const keycode_string_name_t* keycode_string_names_data_kb;
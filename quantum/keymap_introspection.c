@@ -175,8 +175,48 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
     return key_override_get_raw(key_override_idx);
 }
 
+static uint16_t key_override_index[ARRAY_SIZE(key_overrides)];
+
+uint16_t* key_override_index_storage(void) {
+    return key_override_index;
+}
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Table
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
+
+uint16_t leader_table_count_raw(void) {
+    return ARRAY_SIZE(leader_table);
+}
+
+__attribute__((weak)) uint16_t leader_table_count(void) {
+    return leader_table_count_raw();
+}
+
+STATIC_ASSERT(ARRAY_SIZE(leader_table) <= UINT8_MAX, "Number of leader table entries exceeds maximum of 255.");
+
+const leader_table_entry_t* leader_table_get_raw(uint16_t leader_table_idx) {
+    if (leader_table_idx >= leader_table_count_raw()) {
+        return NULL;
+    }
+    return &leader_table[leader_table_idx];
+}
+
+__attribute__((weak)) const leader_table_entry_t* leader_table_get(uint16_t leader_table_idx) {
+    return leader_table_get_raw(leader_table_idx);
+}
+
+static uint8_t leader_table_order[ARRAY_SIZE(leader_table)];
+
+uint8_t* leader_table_order_storage(void) {
+    return leader_table_order;
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Community modules (must be last in this file!)
 
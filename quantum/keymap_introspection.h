@@ -108,4 +108,31 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 // Get the key override definitions, potentially stored dynamically
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
+// Get the storage for the key override trigger index, one entry per key override stored in firmware
+uint16_t* key_override_index_storage(void);
+
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Table
+
+#if defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
+
+// Forward declaration of leader_table_entry_t so we don't need to deal with header reordering
+struct leader_table_entry_t;
+typedef struct leader_table_entry_t leader_table_entry_t;
+
+// Get the number of leader table entries defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_table_count_raw(void);
+// Get the number of leader table entries defined in the user's keymap, potentially stored dynamically
+uint16_t leader_table_count(void);
+
+// Get the leader table entries, stored in firmware rather than any other persistent storage
+const leader_table_entry_t* leader_table_get_raw(uint16_t leader_table_idx);
+// Get the leader table entries, potentially stored dynamically
+const leader_table_entry_t* leader_table_get(uint16_t leader_table_idx);
+
+// Get the storage for the sorted order of the leader table, one entry per leader table entry stored in firmware
+uint8_t* leader_table_order_storage(void);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_TABLE_ENABLE)
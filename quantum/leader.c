@@ -7,15 +7,20 @@
 
 #include <string.h>
 
+#ifdef LEADER_TABLE_ENABLE
+#    include "keymap_introspection.h"
+#    include "quantum.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
 
 // Leader key stuff
-bool     leading              = false;
-uint16_t leader_time          = 0;
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+bool     leading                                     = false;
+uint16_t leader_time                                 = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_MAX_LENGTH] = {0, 0, 0, 0, 0};
+uint8_t  leader_sequence_size                        = 0;
 
 __attribute__((weak)) void leader_start_user(void) {}
 
@@ -25,6 +30,90 @@ __attribute__((weak)) bool leader_add_user(uint16_t keycode) {
     return false;
 }
 
+#ifdef LEADER_TABLE_ENABLE
+/* The leader table is matched as a prefix trie: its entries are sorted by sequence, so all entries that start
+ * with the keys typed so far form a contiguous range of the sorted order, which each key narrows down. Shorter
+ * sequences sort before longer ones starting with them, so a complete sequence is always first in its range. */
+static bool    leader_table_sorted = false;
+static uint8_t leader_table_size   = 0;
+static uint8_t leader_table_first  = 0; // range of leader_table_order_storage() still matching the sequence
+static uint8_t leader_table_last   = 0; // one past the end of the range
+
+__attribute__((weak)) bool leader_table_matched_user(uint8_t index) {
+    return true;
+}
+
+static uint16_t leader_table_key(uint8_t index, uint8_t position) {
+    return leader_table_get(index)->sequence[position];
+}
+
+static bool leader_table_less(uint8_t a, uint8_t b) {
+    for (uint8_t i = 0; i < LEADER_SEQUENCE_MAX_LENGTH; i++) {
+        uint16_t key_a = leader_table_key(a, i);
+        uint16_t key_b = leader_table_key(b, i);
+        if (key_a != key_b) {
+            return key_a < key_b;
+        }
+    }
+    return a < b;
+}
+
+static void leader_table_sort(void) {
+    uint8_t *order    = leader_table_order_storage();
+    leader_table_size = MIN(leader_table_count(), leader_table_count_raw());
+
+    for (uint8_t i = 0; i < leader_table_size; i++) {
+        uint8_t index = i;
+        uint8_t j     = i;
+        for (; j > 0 && leader_table_less(index, order[j - 1]); j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = index;
+    }
+    leader_table_sorted = true;
+}
+
+// First position in the range whose key at `position` is not less than `keycode`, or `upper` past it
+static uint8_t leader_table_bound(uint8_t position, uint16_t keycode, bool upper) {
+    const uint8_t *order = leader_table_order_storage();
+    uint8_t        first = leader_table_first;
+    uint8_t        last  = leader_table_last;
+    while (first < last) {
+        uint8_t  middle = first + (last - first) / 2;
+        uint16_t key    = leader_table_key(order[middle], position);
+        if (key < keycode || (upper && key == keycode)) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+// Whether the first entry of the range is exactly the sequence typed so far
+static bool leader_table_complete(void) {
+    if (leader_table_first == leader_table_last || leader_sequence_size == 0) {
+        return false;
+    }
+    uint8_t index = leader_table_order_storage()[leader_table_first];
+    return leader_sequence_size == LEADER_SEQUENCE_MAX_LENGTH || leader_table_key(index, leader_sequence_size) == KC_NO;
+}
+
+static void leader_table_fire(void) {
+    if (leader_table_complete()) {
+        uint8_t index = leader_table_order_storage()[leader_table_first];
+        if (leader_table_matched_user(index) && leader_table_get(index)->keycode != KC_NO) {
+            tap_code16(leader_table_get(index)->keycode);
+        }
+    }
+    leader_table_first = leader_table_last = 0;
+}
+
+void leader_table_invalidate(void) {
+    leader_table_sorted = false;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -34,10 +123,21 @@ void leader_start(void) {
     leader_time          = timer_read();
     leader_sequence_size = 0;
     memset(leader_sequence, 0, sizeof(leader_sequence));
+
+#ifdef LEADER_TABLE_ENABLE
+    if (!leader_table_sorted) {
+        leader_table_sort();
+    }
+    leader_table_first = 0;
+    leader_table_last  = leader_table_size;
+#endif
 }
 
 void leader_end(void) {
     leading = false;
+#ifdef LEADER_TABLE_ENABLE
+    leader_table_fire();
+#endif
     leader_end_user();
 }
 
@@ -65,9 +165,26 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_TABLE_ENABLE
+    // Narrowed before leader_add_user() gets to end the sequence, so that only an entry matching it fires
+    uint8_t position   = leader_sequence_size - 1;
+    uint8_t first      = leader_table_bound(position, keycode, false);
+    uint8_t last       = leader_table_bound(position, keycode, true);
+    leader_table_first = first;
+    leader_table_last  = last;
+#endif
+
     if (leader_add_user(keycode)) {
         leader_end();
+        return true;
     }
+
+#ifdef LEADER_TABLE_ENABLE
+    // End right away when no sequence can match anymore, or the one that does can't be extended
+    if (first == last || (last - first == 1 && leader_table_complete())) {
+        leader_end();
+    }
+#endif
     return true;
 }
 
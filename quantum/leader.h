@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,36 @@
  * \{
  */
 
+/** \brief The maximum number of keys in a leader sequence. */
+#define LEADER_SEQUENCE_MAX_LENGTH 5
+
+#ifdef LEADER_TABLE_ENABLE
+/**
+ * \brief A leader sequence and the keycode it sends, for the `leader_table` array in the keymap.
+ */
+typedef struct leader_table_entry_t {
+    uint16_t sequence[LEADER_SEQUENCE_MAX_LENGTH]; // the keys following the leader key, unused keys are KC_NO
+    uint16_t keycode;                              // tapped when the sequence is complete
+} leader_table_entry_t;
+
+#    define LEADER_TABLE_ENTRY(kc, ...) \
+        { .sequence = {__VA_ARGS__}, .keycode = (kc) }
+
+/**
+ * \brief User callback, invoked when a sequence in the leader table is complete.
+ *
+ * \param index The index of the entry in `leader_table`.
+ *
+ * \return `true` to tap the keycode of the entry, `false` to skip it.
+ */
+bool leader_table_matched_user(uint8_t index);
+
+/**
+ * \brief Invalidates the sorted order of the leader table, e.g. after changing its entries at runtime.
+ */
+void leader_table_invalidate(void);
+#endif
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -0,0 +1,57 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "binary_log.h"
+
+static sendchar_func_t binary_log_sendchar = sendchar;
+
+void binary_log_set_sendchar(sendchar_func_t func) {
+    binary_log_sendchar = func;
+}
+
+// Each put returns the new payload length, or 0 if the argument doesn't fit,
+// so a record always ends on an argument boundary
+static uint8_t binary_log_put_int(uint8_t *buffer, uint8_t length, uint32_t value) {
+    do {
+        if (length >= BINARY_LOG_MAX_PAYLOAD) {
+            return 0;
+        }
+        buffer[length] = value & 0x7F;
+        value >>= 7;
+        buffer[length++] |= value ? 0x80 : 0;
+    } while (value);
+    return length;
+}
+
+static uint8_t binary_log_put_str(uint8_t *buffer, uint8_t length, const char *str) {
+    if (length >= BINARY_LOG_MAX_PAYLOAD) {
+        return 0;
+    }
+    // Cut the string short to leave room for its terminator
+    while (*str && length < BINARY_LOG_MAX_PAYLOAD - 1) {
+        buffer[length++] = *str++;
+    }
+    buffer[length++] = '\0';
+    return length;
+}
+
+void binary_log_write(uint16_t id, const binary_log_arg_t *args, uint8_t count) {
+    uint8_t payload[BINARY_LOG_MAX_PAYLOAD];
+    uint8_t length = 0;
+
+    payload[length++] = id & 0xFF;
+    payload[length++] = id >> 8;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t next = args[i].str ? binary_log_put_str(payload, length, args[i].str) : binary_log_put_int(payload, length, args[i].value);
+        if (!next) {
+            break;
+        }
+        length = next;
+    }
+
+    binary_log_sendchar(BINARY_LOG_MARKER);
+    binary_log_sendchar(length);
+    for (uint8_t i = 0; i < length; i++) {
+        binary_log_sendchar(payload[i]);
+    }
+}
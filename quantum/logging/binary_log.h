@@ -0,0 +1,88 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sendchar.h"
+
+/**
+ * \file
+ *
+ * \defgroup binary_log Binary Logging
+ *
+ * Sends log messages as a format ID followed by the raw arguments, instead of
+ * formatting them on the device. The format strings are collected into the
+ * `qmk_log_formats` section, which binary_log.ld keeps in the ELF file but out
+ * of the firmware image. An ID is the offset of its format string in that
+ * section, and `util/binary_log_decoder.py` uses the section of the same build
+ * to turn the records back into text.
+ *
+ * Each record is sent as `BINARY_LOG_MARKER`, the payload length, the ID as
+ * 16 bit little endian, and then one entry per argument: integers as LEB128
+ * encoded 32 bit values, strings as their characters followed by a NUL.
+ * Strings are cut short, and arguments that don't fit are left out, to keep
+ * the payload within `BINARY_LOG_MAX_PAYLOAD`.
+ * \{
+ */
+
+#ifndef BINARY_LOG_MAX_PAYLOAD
+#    define BINARY_LOG_MAX_PAYLOAD 48
+#endif
+
+/** \brief Start of a binary record. Text output never contains it, so both can share the console. */
+#define BINARY_LOG_MARKER 0x01
+
+typedef struct {
+    const char *str; // NULL for integers
+    uint32_t    value;
+} binary_log_arg_t;
+
+extern const char __start_qmk_log_formats[];
+
+void binary_log_write(uint16_t id, const binary_log_arg_t *args, uint8_t count);
+
+/**
+ * \brief Set the function that records are written with, `sendchar()` by default.
+ */
+void binary_log_set_sendchar(sendchar_func_t func);
+
+static inline binary_log_arg_t binary_log_int(uint32_t value) {
+    return (binary_log_arg_t){.str = NULL, .value = value};
+}
+
+static inline binary_log_arg_t binary_log_str(const char *str) {
+    return (binary_log_arg_t){.str = str ? str : "(null)", .value = 0};
+}
+
+// clang-format off
+#define BINARY_LOG_ARG(x) _Generic((x), char *: binary_log_str, const char *: binary_log_str, default: binary_log_int)(x)
+
+#define BINARY_LOG_NARGS(...) BINARY_LOG_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define BINARY_LOG_NARGS_(_, a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+
+#define BINARY_LOG_ARGS_0()
+#define BINARY_LOG_ARGS_1(a) BINARY_LOG_ARG(a)
+#define BINARY_LOG_ARGS_2(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_1(__VA_ARGS__)
+#define BINARY_LOG_ARGS_3(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_2(__VA_ARGS__)
+#define BINARY_LOG_ARGS_4(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_3(__VA_ARGS__)
+#define BINARY_LOG_ARGS_5(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_4(__VA_ARGS__)
+#define BINARY_LOG_ARGS_6(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_5(__VA_ARGS__)
+#define BINARY_LOG_ARGS_7(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_6(__VA_ARGS__)
+#define BINARY_LOG_ARGS_8(a, ...) BINARY_LOG_ARG(a), BINARY_LOG_ARGS_7(__VA_ARGS__)
+#define BINARY_LOG_ARGS__(n, ...) BINARY_LOG_ARGS_##n(__VA_ARGS__)
+#define BINARY_LOG_ARGS_(n, ...) BINARY_LOG_ARGS__(n, ##__VA_ARGS__)
+// clang-format on
+
+/**
+ * \brief Log a message in binary form. The format must be a string literal, and takes up to eight integer or string arguments.
+ */
+#define binary_log(fmt, ...)                                                                                                                                                     \
+    do {                                                                                                                                                                         \
+        static const char      binary_log_format_[] __attribute__((section("qmk_log_formats"), used)) = "" fmt;                                                                 \
+        const binary_log_arg_t binary_log_args_[BINARY_LOG_NARGS(__VA_ARGS__) + 1] = {BINARY_LOG_ARGS_(BINARY_LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__)};                          \
+        binary_log_write((uint16_t)(binary_log_format_ - __start_qmk_log_formats), binary_log_args_, BINARY_LOG_NARGS(__VA_ARGS__));                                             \
+    } while (0)
+
+/** \} */
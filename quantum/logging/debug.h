@@ -54,7 +54,13 @@ extern debug_config_t debug_config;
 /*
  * Debug print utils
  */
-#ifndef NO_DEBUG
+#if !defined(NO_DEBUG) && defined(BINARY_LOG_ENABLE) && !defined(NO_PRINT) && !defined(USER_PRINT) && !defined(__cplusplus)
+#    include "binary_log.h"
+#    define dprintf(fmt, ...)                                        \
+        do {                                                         \
+            if (debug_config.enable) binary_log(fmt, ##__VA_ARGS__); \
+        } while (0)
+#elif !defined(NO_DEBUG)
 #    define dprintf(fmt, ...)                                     \
         do {                                                      \
             if (debug_config.enable) xprintf(fmt, ##__VA_ARGS__); \
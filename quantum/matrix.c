@@ -20,8 +20,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "util.h"
 #include "matrix.h"
 #include "debounce.h"
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    include "matrix_telemetry.h"
+#endif
 #include "atomic_util.h"
 
+#ifdef MATRIX_IO_DELAY_ADAPTIVE
+#    include "timer.h"
+#    include "wait.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -131,6 +139,105 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
 
 #elif defined(DIODE_DIRECTION)
 #    if defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#        ifdef MATRIX_IO_DELAY_ADAPTIVE
+#            ifndef MATRIX_IO_DELAY
+#                define MATRIX_IO_DELAY 30
+#            endif
+#            ifndef MATRIX_IO_DELAY_ADAPTIVE_MARGIN
+#                define MATRIX_IO_DELAY_ADAPTIVE_MARGIN 2
+#            endif
+#            ifndef MATRIX_IO_DELAY_ADAPTIVE_INTERVAL
+#                define MATRIX_IO_DELAY_ADAPTIVE_INTERVAL 10000
+#            endif
+// Free running counter the settle time is measured with, and its conversion to whole microseconds (rounded up)
+#            if !defined(MATRIX_IO_DELAY_ADAPTIVE_COUNTER) && defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#                define MATRIX_IO_DELAY_ADAPTIVE_COUNTER() chSysGetRealtimeCounterX()
+#                define MATRIX_IO_DELAY_ADAPTIVE_COUNTER_TO_US(ticks) ((ticks) == 0 ? 0 : RTC2US(REALTIME_COUNTER_CLOCK, ticks))
+#            endif
+#            ifndef MATRIX_IO_DELAY_ADAPTIVE_COUNTER
+// Without a finer clock the millisecond timer is all there is, so a settle time can only be bounded by the next whole millisecond
+#                define MATRIX_IO_DELAY_ADAPTIVE_COUNTER() timer_read32()
+#                define MATRIX_IO_DELAY_ADAPTIVE_COUNTER_TO_US(ticks) (((ticks) + 1) * 1000)
+#            endif
+#            if (DIODE_DIRECTION == COL2ROW)
+#                define MATRIX_OUTPUT_LINES MATRIX_ROWS_PER_HAND
+#                define MATRIX_INPUT_LINES MATRIX_COLS
+#                define matrix_input_pins col_pins
+#            else
+#                define MATRIX_OUTPUT_LINES MATRIX_COLS
+#                define MATRIX_INPUT_LINES MATRIX_ROWS_PER_HAND
+#                define matrix_input_pins row_pins
+#            endif
+
+// Per output line settle time in microseconds, never more than MATRIX_IO_DELAY
+static uint16_t unselect_delay_us[MATRIX_OUTPUT_LINES];
+static bool     unselect_calibrate[MATRIX_OUTPUT_LINES];
+static uint16_t unselect_calibration_timer;
+
+static bool matrix_inputs_idle(void) {
+    for (uint8_t x = 0; x < MATRIX_INPUT_LINES; x++) {
+        if (readMatrixPin(matrix_input_pins[x]) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void matrix_adaptive_delay_init(void) {
+    for (uint8_t x = 0; x < MATRIX_OUTPUT_LINES; x++) {
+        unselect_delay_us[x]  = MATRIX_IO_DELAY;
+        unselect_calibrate[x] = true;
+    }
+    unselect_calibration_timer = timer_read();
+}
+
+static void matrix_adaptive_delay_task(void) {
+    if (timer_elapsed(unselect_calibration_timer) > MATRIX_IO_DELAY_ADAPTIVE_INTERVAL) {
+        for (uint8_t x = 0; x < MATRIX_OUTPUT_LINES; x++) {
+            unselect_calibrate[x] = true;
+        }
+        unselect_calibration_timer = timer_read();
+    }
+}
+
+/**
+ * @brief Waits for the input lines to settle after unselecting an output line.
+ *
+ * Only a line with a key held down can pull an input line away from its idle
+ * state, so calibration happens on the first such strobe after boot and once
+ * every MATRIX_IO_DELAY_ADAPTIVE_INTERVAL milliseconds afterwards: the inputs
+ * are polled until they read idle, and the time measured with
+ * MATRIX_IO_DELAY_ADAPTIVE_COUNTER() up to that read, plus
+ * MATRIX_IO_DELAY_ADAPTIVE_MARGIN, becomes the delay for that line. A line
+ * that never settles within MATRIX_IO_DELAY keeps the full delay.
+ */
+static void matrix_adaptive_unselect_delay(uint8_t line, bool key_pressed) {
+    if (!key_pressed) {
+        // Nothing on this line was holding an input, confirm and move on
+        if (matrix_inputs_idle()) {
+            return;
+        }
+    } else if (unselect_calibrate[line]) {
+        uint32_t start = MATRIX_IO_DELAY_ADAPTIVE_COUNTER();
+        uint32_t elapsed;
+        bool     idle;
+        do {
+            // Reading the time after the inputs makes it an upper bound for how long they took to settle
+            idle    = matrix_inputs_idle();
+            elapsed = MATRIX_IO_DELAY_ADAPTIVE_COUNTER_TO_US((uint32_t)(MATRIX_IO_DELAY_ADAPTIVE_COUNTER() - start));
+        } while (!idle && elapsed < MATRIX_IO_DELAY);
+        unselect_calibrate[line] = false;
+        unselect_delay_us[line]  = MIN(elapsed + MATRIX_IO_DELAY_ADAPTIVE_MARGIN, MATRIX_IO_DELAY);
+        if (idle) {
+            return;
+        }
+        // A coarse counter may not have covered the full delay yet
+    }
+    wait_us(unselect_delay_us[line]);
+}
+#            define matrix_output_unselect_delay(line, key_pressed) matrix_adaptive_unselect_delay(line, key_pressed)
+#        endif // MATRIX_IO_DELAY_ADAPTIVE
+
 #        if (DIODE_DIRECTION == COL2ROW)
 
 static bool select_row(uint8_t row) {
@@ -299,6 +406,10 @@ void matrix_init(void) {
     // initialize key pins
     matrix_init_pins();
 
+#if defined(MATRIX_IO_DELAY_ADAPTIVE) && defined(MATRIX_OUTPUT_LINES)
+    matrix_adaptive_delay_init();
+#endif
+
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
@@ -319,6 +430,10 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
+#if defined(MATRIX_IO_DELAY_ADAPTIVE) && defined(MATRIX_OUTPUT_LINES)
+    matrix_adaptive_delay_task();
+#endif
+
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < MATRIX_ROWS_PER_HAND; current_row++) {
@@ -340,6 +455,14 @@ uint8_t matrix_scan(void) {
 #else
     changed = debounce(raw_matrix, matrix, changed);
     matrix_scan_kb();
+#endif
+
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    matrix_telemetry_scan(raw_matrix, matrix + thisHand);
+#    else
+    matrix_telemetry_scan(raw_matrix, matrix);
+#    endif
 #endif
     return (uint8_t)changed;
 }
@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 2
+#define MATRIX_COLS 2
+
+/* Here, "pins" 0 and 1 are the rows and 2 and 3 the columns. */
+#define MATRIX_ROW_PINS {0, 1}
+#define MATRIX_COL_PINS {2, 3}
+#define DIODE_DIRECTION COL2ROW
+
+/* Above 255, to make sure the delay is not truncated */
+#define MATRIX_IO_DELAY 300
+#define MATRIX_IO_DELAY_ADAPTIVE
+#define MATRIX_IO_DELAY_ADAPTIVE_COUNTER() mock_time_us
+#define MATRIX_IO_DELAY_ADAPTIVE_COUNTER_TO_US(ticks) (ticks)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
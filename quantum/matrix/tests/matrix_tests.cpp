@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "matrix/tests/mock.h"
+
+extern matrix_row_t matrix[MATRIX_ROWS];
+}
+
+#define MATRIX_IO_DELAY_ADAPTIVE_MARGIN 2
+
+class MatrixAdaptiveDelayTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_reset();
+        matrix_init();
+    }
+
+    /* Microseconds waited for the lines to settle during one scan */
+    uint32_t scan(void) {
+        mock_waited_us = 0;
+        matrix_scan();
+        return mock_waited_us;
+    }
+
+    bool key_is_on(uint8_t row, uint8_t col) {
+        return matrix[row] & ((matrix_row_t)1 << col);
+    }
+};
+
+TEST_F(MatrixAdaptiveDelayTest, IdleLinesDoNotWait) {
+    EXPECT_EQ(scan(), 0);
+    EXPECT_EQ(scan(), 0);
+}
+
+TEST_F(MatrixAdaptiveDelayTest, PressedLineWaitsForTheMeasuredSettleTime) {
+    mock_settle_us = 10;
+    mock_press_key(0, 0);
+
+    /* Calibration polls the inputs instead of waiting */
+    EXPECT_EQ(scan(), 0);
+    EXPECT_TRUE(key_is_on(0, 0));
+
+    uint32_t waited = scan();
+    EXPECT_GE(waited, 10 + MATRIX_IO_DELAY_ADAPTIVE_MARGIN);
+    EXPECT_LE(waited, 10 + MATRIX_IO_DELAY_ADAPTIVE_MARGIN + 2);
+    EXPECT_TRUE(key_is_on(0, 0));
+    EXPECT_FALSE(key_is_on(1, 0));
+}
+
+TEST_F(MatrixAdaptiveDelayTest, SlowPinReadsAreMeasuredAsTime) {
+    /* Every poll of the inputs takes several microseconds, counting polls would come up short */
+    mock_read_cost_us = 4;
+    mock_settle_us    = 20;
+    mock_press_key(0, 0);
+
+    scan();
+    EXPECT_GE(scan(), 20 + MATRIX_IO_DELAY_ADAPTIVE_MARGIN);
+    EXPECT_FALSE(key_is_on(1, 0));
+}
+
+TEST_F(MatrixAdaptiveDelayTest, LineThatNeverSettlesKeepsTheFullDelay) {
+    mock_settle_us = 100000;
+    mock_press_key(0, 0);
+
+    scan();
+    /* The pressed line and the one after it, which still sees the column pulled low */
+    EXPECT_EQ(scan(), 2 * MATRIX_IO_DELAY);
+}
@@ -0,0 +1,75 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "matrix.h"
+#include "mock.h"
+
+uint32_t mock_time_us;
+uint32_t mock_waited_us;
+uint32_t mock_read_cost_us;
+uint32_t mock_settle_us;
+
+static bool     keys[MATRIX_ROWS][MATRIX_COLS];
+static bool     row_low[MATRIX_ROWS];
+static uint32_t row_released_at[MATRIX_ROWS];
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+void mock_reset(void) {
+    mock_time_us      = 0;
+    mock_waited_us    = 0;
+    mock_read_cost_us = 1;
+    mock_settle_us    = 0;
+    memset(keys, 0, sizeof(keys));
+    memset(row_low, 0, sizeof(row_low));
+    memset(row_released_at, 0, sizeof(row_released_at));
+}
+
+void mock_press_key(uint8_t row, uint8_t col) {
+    keys[row][col] = true;
+}
+
+void mock_set_pin_input_high(pin_t pin) {
+    if (pin < MATRIX_ROWS && row_low[pin]) {
+        row_low[pin]         = false;
+        row_released_at[pin] = mock_time_us;
+    }
+}
+
+void mock_write_pin_low(pin_t pin) {
+    if (pin < MATRIX_ROWS) {
+        row_low[pin] = true;
+    }
+}
+
+bool mock_read_pin(pin_t pin) {
+    mock_time_us += mock_read_cost_us;
+
+    uint8_t col = pin - MATRIX_ROWS;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (keys[row][col] && (row_low[row] || mock_time_us - row_released_at[row] < mock_settle_us)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void wait_us(uint32_t us) {
+    mock_time_us += us;
+    mock_waited_us += us;
+}
+
+void matrix_output_select_delay(void) {}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
+
+void debounce_init(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], bool changed) {
+    memcpy(cooked, raw, sizeof(matrix_row_t) * MATRIX_ROWS);
+    return changed;
+}
@@ -0,0 +1,30 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+/* Microseconds since the start of the test, advanced by pin reads and wait_us() */
+extern uint32_t mock_time_us;
+/* Microseconds spent in wait_us() */
+extern uint32_t mock_waited_us;
+/* How long a single pin read takes */
+extern uint32_t mock_read_cost_us;
+/* How long a column stays pulled low after the row of a pressed key is unselected */
+extern uint32_t mock_settle_us;
+
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_set_pin_output(pin)
+#define gpio_write_pin_low(pin) mock_write_pin_low(pin)
+#define gpio_write_pin_high(pin) mock_set_pin_input_high(pin)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+void mock_set_pin_input_high(pin_t pin);
+void mock_write_pin_low(pin_t pin);
+bool mock_read_pin(pin_t pin);
+
+void mock_reset(void);
+void mock_press_key(uint8_t row, uint8_t col);
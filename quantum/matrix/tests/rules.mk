@@ -0,0 +1,9 @@
+matrix_DEFS := -DIGNORE_ATOMIC_BLOCK -DWAIT_US_MOCKED -DNO_PRINT
+matrix_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_SRC := \
+	platforms/timer.c \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
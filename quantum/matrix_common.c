@@ -1,5 +1,8 @@
 #include "matrix.h"
 #include "debounce.h"
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    include "matrix_telemetry.h"
+#endif
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
@@ -171,6 +174,14 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     matrix_scan_kb();
 #endif
 
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    ifdef SPLIT_KEYBOARD
+    matrix_telemetry_scan(raw_matrix, matrix + thisHand);
+#    else
+    matrix_telemetry_scan(raw_matrix, matrix);
+#    endif
+#endif
+
     return changed;
 }
 
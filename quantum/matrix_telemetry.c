@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include <inttypes.h>
+#include "matrix_telemetry.h"
+#include "timer.h"
+#include "debug.h"
+#include "print.h"
+#include "util.h"
+
+#ifdef PROTOCOL_CHIBIOS
+#    include <ch.h>
+#endif
+
+// Free running counter scans are timed with, and its conversion to microseconds
+#if !defined(MATRIX_TELEMETRY_COUNTER) && defined(PROTOCOL_CHIBIOS) && (PORT_SUPPORTS_RT == TRUE)
+#    define MATRIX_TELEMETRY_COUNTER() chSysGetRealtimeCounterX()
+#    define MATRIX_TELEMETRY_COUNTER_TO_US(ticks) ((ticks) == 0 ? 0 : RTC2US(REALTIME_COUNTER_CLOCK, ticks))
+#endif
+// Scan intervals are bucketed by MATRIX_TELEMETRY_SCAN_BUCKET_US microseconds, debounce latency by the millisecond
+#ifndef MATRIX_TELEMETRY_COUNTER
+// Without a finer clock scans can only be timed to the millisecond
+#    define MATRIX_TELEMETRY_COUNTER() timer_read32()
+#    define MATRIX_TELEMETRY_COUNTER_TO_US(ticks) ((ticks) * 1000)
+#    ifndef MATRIX_TELEMETRY_SCAN_BUCKET_US
+#        define MATRIX_TELEMETRY_SCAN_BUCKET_US 1000
+#    endif
+#endif
+#ifndef MATRIX_TELEMETRY_SCAN_BUCKET_US
+#    define MATRIX_TELEMETRY_SCAN_BUCKET_US 50
+#endif
+
+typedef struct {
+    uint32_t buckets[MATRIX_TELEMETRY_BUCKETS];
+    uint32_t count;
+    uint16_t max;
+} telemetry_histogram_t;
+
+static telemetry_histogram_t debounce_latency;
+static telemetry_histogram_t scan_interval;
+
+// Previous scan, used to find the edges of this one
+static matrix_row_t prev_raw[MATRIX_ROWS_PER_HAND];
+static matrix_row_t prev_cooked[MATRIX_ROWS_PER_HAND];
+// Keys with a raw edge that hasn't reached the debounced matrix yet
+static matrix_row_t pending[MATRIX_ROWS_PER_HAND];
+static uint16_t     raw_edge_time[MATRIX_ROWS_PER_HAND][MATRIX_COLS];
+
+static bool     has_last_scan;
+static uint32_t last_scan_count;
+static uint16_t scan_rate_timer;
+static uint32_t scan_rate_count;
+static uint32_t scan_rate;
+
+static void histogram_record(telemetry_histogram_t *histogram, uint16_t value, uint16_t bucket_width) {
+    uint16_t bucket = value / bucket_width;
+    histogram->buckets[bucket < MATRIX_TELEMETRY_BUCKETS ? bucket : MATRIX_TELEMETRY_BUCKETS - 1]++;
+    histogram->count++;
+    if (value > histogram->max) {
+        histogram->max = value;
+    }
+}
+
+// Lower bound of the bucket the percentile falls in
+static uint16_t histogram_percentile(const telemetry_histogram_t *histogram, uint8_t percent, uint16_t bucket_width) {
+    // Rank of the sample, rounded up, without overflowing 32 bits
+    uint32_t target     = (histogram->count / 100) * percent + ((histogram->count % 100) * percent + 99) / 100;
+    uint32_t cumulative = 0;
+    for (uint16_t i = 0; i < MATRIX_TELEMETRY_BUCKETS - 1; i++) {
+        cumulative += histogram->buckets[i];
+        if (cumulative >= target) {
+            return i * bucket_width;
+        }
+    }
+    return histogram->max;
+}
+
+static void histogram_summarize(const telemetry_histogram_t *histogram, uint16_t bucket_width, matrix_telemetry_summary_t *summary) {
+    summary->count = histogram->count;
+    if (histogram->count == 0) {
+        summary->p50 = summary->p90 = summary->p99 = summary->max = 0;
+        return;
+    }
+    summary->p50 = histogram_percentile(histogram, 50, bucket_width);
+    summary->p90 = histogram_percentile(histogram, 90, bucket_width);
+    summary->p99 = histogram_percentile(histogram, 99, bucket_width);
+    summary->max = histogram->max;
+}
+
+void matrix_telemetry_scan(const matrix_row_t raw[], const matrix_row_t cooked[]) {
+    uint16_t now   = timer_read();
+    uint32_t count = MATRIX_TELEMETRY_COUNTER();
+
+    if (has_last_scan) {
+        uint32_t interval = MATRIX_TELEMETRY_COUNTER_TO_US((uint32_t)(count - last_scan_count));
+        histogram_record(&scan_interval, MIN(interval, UINT16_MAX), MATRIX_TELEMETRY_SCAN_BUCKET_US);
+    } else {
+        scan_rate_timer = now;
+        has_last_scan   = true;
+    }
+    last_scan_count = count;
+
+    if (TIMER_DIFF_16(now, scan_rate_timer) >= 1000) {
+        scan_rate       = scan_rate_count;
+        scan_rate_count = 0;
+        scan_rate_timer = now;
+    }
+    scan_rate_count++;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        matrix_row_t started  = (raw[row] ^ prev_raw[row]) & ~pending[row];
+        matrix_row_t released = (cooked[row] ^ prev_cooked[row]) & (pending[row] | started);
+
+        matrix_row_t edges    = started | released;
+        for (uint8_t col = 0; edges; col++, edges >>= 1) {
+            matrix_row_t col_mask = (matrix_row_t)1 << col;
+            if (started & col_mask) {
+                raw_edge_time[row][col] = now;
+            }
+            if (released & col_mask) {
+                histogram_record(&debounce_latency, TIMER_DIFF_16(now, raw_edge_time[row][col]), 1);
+            }
+        }
+
+        // Keys that bounced back keep their first edge time, unless they stay back long enough to count as noise
+        pending[row] &= ~released;
+        matrix_row_t settled = pending[row] & ~(raw[row] ^ cooked[row]);
+        for (uint8_t col = 0; settled; col++, settled >>= 1) {
+            if ((settled & 1) && TIMER_DIFF_16(now, raw_edge_time[row][col]) > MATRIX_TELEMETRY_BOUNCE_WINDOW) {
+                pending[row] &= ~((matrix_row_t)1 << col);
+            }
+        }
+        pending[row] |= (raw[row] ^ cooked[row]);
+        prev_raw[row]    = raw[row];
+        prev_cooked[row] = cooked[row];
+    }
+}
+
+void matrix_telemetry_reset(void) {
+    memset(&debounce_latency, 0, sizeof(debounce_latency));
+    memset(&scan_interval, 0, sizeof(scan_interval));
+    memset(prev_raw, 0, sizeof(prev_raw));
+    memset(prev_cooked, 0, sizeof(prev_cooked));
+    memset(pending, 0, sizeof(pending));
+    has_last_scan   = false;
+    scan_rate_count = 0;
+    scan_rate       = 0;
+}
+
+void matrix_telemetry_get_stats(matrix_telemetry_stats_t *stats) {
+    histogram_summarize(&debounce_latency, 1, &stats->debounce_latency);
+    histogram_summarize(&scan_interval, MATRIX_TELEMETRY_SCAN_BUCKET_US, &stats->scan_interval);
+    stats->scan_rate = scan_rate;
+}
+
+static uint8_t *serialize_u16(uint8_t *data, uint16_t value) {
+    *data++ = value & 0xFF;
+    *data++ = value >> 8;
+    return data;
+}
+
+static uint8_t *serialize_u32(uint8_t *data, uint32_t value) {
+    data = serialize_u16(data, value & 0xFFFF);
+    return serialize_u16(data, value >> 16);
+}
+
+static uint8_t *serialize_summary(uint8_t *data, const matrix_telemetry_summary_t *summary) {
+    data = serialize_u32(data, summary->count);
+    data = serialize_u16(data, summary->p50);
+    data = serialize_u16(data, summary->p90);
+    data = serialize_u16(data, summary->p99);
+    return serialize_u16(data, summary->max);
+}
+
+uint8_t matrix_telemetry_serialize(uint8_t *data, uint8_t length) {
+    // Two summaries of 12 bytes each, followed by the scan rate
+    const uint8_t size = 2 * 12 + 4;
+    if (length < size) {
+        return 0;
+    }
+
+    matrix_telemetry_stats_t stats;
+    matrix_telemetry_get_stats(&stats);
+
+    data = serialize_summary(data, &stats.debounce_latency);
+    data = serialize_summary(data, &stats.scan_interval);
+    serialize_u32(data, stats.scan_rate);
+    return size;
+}
+
+bool matrix_telemetry_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 2 || data[0] != MATRIX_TELEMETRY_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    // Read the flag before the reply overwrites it
+    bool reset = data[1] == MATRIX_TELEMETRY_RAW_HID_RESET;
+    memset(data + 1, 0, length - 1);
+    matrix_telemetry_serialize(data + 1, length - 1);
+    if (reset) {
+        matrix_telemetry_reset();
+    }
+    return true;
+}
+
+void matrix_telemetry_task(void) {
+#if MATRIX_TELEMETRY_REPORT_INTERVAL > 0
+    static uint32_t report_timer = 0;
+    if (timer_elapsed32(report_timer) < MATRIX_TELEMETRY_REPORT_INTERVAL) {
+        return;
+    }
+    report_timer = timer_read32();
+
+    matrix_telemetry_stats_t stats;
+    matrix_telemetry_get_stats(&stats);
+    dprintf("matrix scan rate: %" PRIu32 "/s, interval p50/p90/p99/max: %u/%u/%u/%u us\n", stats.scan_rate, stats.scan_interval.p50, stats.scan_interval.p90, stats.scan_interval.p99, stats.scan_interval.max);
+    dprintf("debounce latency (%" PRIu32 " edges) p50/p90/p99/max: %u/%u/%u/%u ms\n", stats.debounce_latency.count, stats.debounce_latency.p50, stats.debounce_latency.p90, stats.debounce_latency.p99, stats.debounce_latency.max);
+#endif
+}
@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+
+/** \brief Number of histogram buckets; the last bucket collects everything at or above it. */
+#ifndef MATRIX_TELEMETRY_BUCKETS
+#    define MATRIX_TELEMETRY_BUCKETS 32
+#endif
+
+/** \brief First byte of the raw HID request answered by matrix_telemetry_raw_hid_receive(). */
+#ifndef MATRIX_TELEMETRY_RAW_HID_COMMAND
+#    define MATRIX_TELEMETRY_RAW_HID_COMMAND 0xF0
+#endif
+
+/** \brief Second byte of the raw HID request to clear the statistics once they are read. */
+#define MATRIX_TELEMETRY_RAW_HID_RESET 0x01
+
+/** \brief How long, in milliseconds, a bounce may return to the debounced state and still be timed from its first edge. */
+#ifndef MATRIX_TELEMETRY_BOUNCE_WINDOW
+#    define MATRIX_TELEMETRY_BOUNCE_WINDOW 20
+#endif
+
+/** \brief How often, in milliseconds, statistics are printed to the console. 0 disables printing. */
+#ifndef MATRIX_TELEMETRY_REPORT_INTERVAL
+#    define MATRIX_TELEMETRY_REPORT_INTERVAL 5000
+#endif
+
+typedef struct {
+    uint32_t count;
+    uint16_t p50;
+    uint16_t p90;
+    uint16_t p99;
+    uint16_t max;
+} matrix_telemetry_summary_t;
+
+typedef struct {
+    matrix_telemetry_summary_t debounce_latency; // raw edge to debounced edge, in ms
+    matrix_telemetry_summary_t scan_interval;    // time between consecutive scans, in us
+    uint32_t                   scan_rate;        // scans per second over the last reporting period
+} matrix_telemetry_stats_t;
+
+/**
+ * \brief Records one matrix scan.
+ *
+ * Call after debounce() with the rows of this hand. Raw transitions are
+ * timestamped, and the delay from the first edge until the debounced matrix
+ * follows is recorded. Raw transitions that return to the debounced state
+ * for longer than MATRIX_TELEMETRY_BOUNCE_WINDOW are discarded as noise.
+ *
+ * \param raw the raw matrix rows, MATRIX_ROWS_PER_HAND entries
+ * \param cooked the debounced matrix rows, MATRIX_ROWS_PER_HAND entries
+ */
+void matrix_telemetry_scan(const matrix_row_t raw[], const matrix_row_t cooked[]);
+
+/**
+ * \brief Prints the statistics to the console every MATRIX_TELEMETRY_REPORT_INTERVAL.
+ */
+void matrix_telemetry_task(void);
+
+/**
+ * \brief Clears all recorded samples and forgets any raw edges still waiting on debounce.
+ */
+void matrix_telemetry_reset(void);
+
+/**
+ * \brief Computes percentiles over the samples recorded since the last reset.
+ */
+void matrix_telemetry_get_stats(matrix_telemetry_stats_t *stats);
+
+/**
+ * \brief Packs the statistics into a little-endian buffer, e.g. for a raw HID reply.
+ *
+ * \return the number of bytes written, 0 if the buffer is too small
+ */
+uint8_t matrix_telemetry_serialize(uint8_t *data, uint8_t length);
+
+/**
+ * \brief Answers a raw HID request for the statistics.
+ *
+ * A request starts with MATRIX_TELEMETRY_RAW_HID_COMMAND, optionally followed
+ * by MATRIX_TELEMETRY_RAW_HID_RESET. The reply replaces the request in place:
+ * the command byte, then the output of matrix_telemetry_serialize(). Called
+ * by the default raw_hid_receive() and by VIA for commands it doesn't know.
+ *
+ * \return true if the request was handled and the buffer should be sent back
+ */
+bool matrix_telemetry_raw_hid_receive(uint8_t *data, uint8_t length);
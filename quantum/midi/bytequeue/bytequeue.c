@@ -1,4 +1,4 @@
-// this is a single reader [maybe multiple writer?] byte queue
+// this is a single reader, single writer byte queue
 // Copyright 2008 Alex Norman
 // writen by Alex Norman
 //
@@ -18,47 +18,33 @@
 // along with avr-bytequeue.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "bytequeue.h"
-#include "interrupt_setting.h"
 
-void bytequeue_init(byteQueue_t* queue, uint8_t* dataArray, byteQueueIndex_t arrayLen) {
-    queue->length = arrayLen;
-    queue->data   = dataArray;
-    queue->start = queue->end = 0;
+void bytequeue_init(byteQueue_t* queue, uint8_t* dataArray, uint16_t arrayLen) {
+    spsc_queue_init(queue, dataArray, arrayLen);
 }
 
 bool bytequeue_enqueue(byteQueue_t* queue, uint8_t item) {
-    interrupt_setting_t setting = store_and_clear_interrupt();
-    // full
-    if (((queue->end + 1) % queue->length) == queue->start) {
-        restore_interrupt_setting(setting);
-        return false;
-    } else {
-        queue->data[queue->end] = item;
-        queue->end              = (queue->end + 1) % queue->length;
-        restore_interrupt_setting(setting);
-        return true;
-    }
+    return spsc_queue_push(queue, item);
+}
+
+byteQueueIndex_t bytequeue_enqueue_many(byteQueue_t* queue, const uint8_t* items, byteQueueIndex_t count) {
+    return spsc_queue_write(queue, items, count);
+}
+
+byteQueueIndex_t bytequeue_dequeue(byteQueue_t* queue, uint8_t* items, byteQueueIndex_t count) {
+    return spsc_queue_read(queue, items, count);
 }
 
 byteQueueIndex_t bytequeue_length(byteQueue_t* queue) {
-    byteQueueIndex_t    len;
-    interrupt_setting_t setting = store_and_clear_interrupt();
-    if (queue->end >= queue->start)
-        len = queue->end - queue->start;
-    else
-        len = (queue->length - queue->start) + queue->end;
-    restore_interrupt_setting(setting);
-    return len;
+    return spsc_queue_length(queue);
 }
 
-// we don't need to avoid interrupts if there is only one reader
+// only the reader calls this, so the item can't be overwritten while it is read
 uint8_t bytequeue_get(byteQueue_t* queue, byteQueueIndex_t index) {
-    return queue->data[(queue->start + index) % queue->length];
+    return spsc_queue_peek(queue, index);
 }
 
 // we just update the start index to remove elements
 void bytequeue_remove(byteQueue_t* queue, byteQueueIndex_t numToRemove) {
-    interrupt_setting_t setting = store_and_clear_interrupt();
-    queue->start                = (queue->start + numToRemove) % queue->length;
-    restore_interrupt_setting(setting);
+    spsc_queue_skip(queue, numToRemove);
 }
@@ -1,4 +1,4 @@
-// this is a single reader [maybe multiple writer?] byte queue
+// this is a single reader, single writer byte queue
 // Copyright 2008 Alex Norman
 // writen by Alex Norman
 //
@@ -25,22 +25,26 @@ extern "C" {
 
 #include <inttypes.h>
 #include <stdbool.h>
+#include "spsc_queue.h"
 
 typedef uint8_t byteQueueIndex_t;
 
-typedef struct {
-    byteQueueIndex_t start;
-    byteQueueIndex_t end;
-    byteQueueIndex_t length;
-    uint8_t*         data;
-} byteQueue_t;
+// one writer and one reader may use the queue at the same time without disabling interrupts
+typedef spsc_queue_t byteQueue_t;
 
 // you must have a queue, an array of data which the queue will use, and the length of that array
-void bytequeue_init(byteQueue_t* queue, uint8_t* dataArray, byteQueueIndex_t arrayLen);
+// the length must be a power of two, up to 256, and the queue holds one item less than that
+void bytequeue_init(byteQueue_t* queue, uint8_t* dataArray, uint16_t arrayLen);
 
 // add an item to the queue, returns false if the queue is full
 bool bytequeue_enqueue(byteQueue_t* queue, uint8_t item);
 
+// add as many of the items to the queue as fit, returns the number added
+byteQueueIndex_t bytequeue_enqueue_many(byteQueue_t* queue, const uint8_t* items, byteQueueIndex_t count);
+
+// take up to count items off the queue, returns the number taken
+byteQueueIndex_t bytequeue_dequeue(byteQueue_t* queue, uint8_t* items, byteQueueIndex_t count);
+
 // get the length of the queue
 byteQueueIndex_t bytequeue_length(byteQueue_t* queue);
 
@@ -59,9 +59,7 @@ void midi_device_init(MidiDevice* device) {
 }
 
 void midi_device_input(MidiDevice* device, uint8_t cnt, uint8_t* input) {
-    uint8_t i;
-    for (i = 0; i < cnt; i++)
-        bytequeue_enqueue(&device->input_queue, input[i]);
+    bytequeue_enqueue_many(&device->input_queue, input, cnt);
 }
 
 void midi_device_set_send_func(MidiDevice* device, midi_var_byte_func_t send_func) {
@@ -76,14 +74,15 @@ void midi_device_process(MidiDevice* device) {
     // call the pre_input_process_callback if there is one
     if (device->pre_input_process_callback) device->pre_input_process_callback(device);
 
-    // pull stuff off the queue and process
+    // pull stuff off the queue in chunks and process
     byteQueueIndex_t len = bytequeue_length(&device->input_queue);
-    uint16_t         i;
+    uint8_t          chunk[16];
     // TODO limit number of bytes processed?
-    for (i = 0; i < len; i++) {
-        uint8_t val = bytequeue_get(&device->input_queue, 0);
-        midi_process_byte(device, val);
-        bytequeue_remove(&device->input_queue, 1);
+    while (len > 0) {
+        byteQueueIndex_t cnt = bytequeue_dequeue(&device->input_queue, chunk, len < sizeof(chunk) ? len : sizeof(chunk));
+        for (byteQueueIndex_t i = 0; i < cnt; i++)
+            midi_process_byte(device, chunk[i]);
+        len -= cnt;
     }
 }
 
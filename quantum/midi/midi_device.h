@@ -46,9 +46,15 @@ extern "C" {
  * @{
  */
 
+#include "compiler_support.h"
 #include "midi_function_types.h"
 #include "bytequeue/bytequeue.h"
-#define MIDI_INPUT_QUEUE_LENGTH 192
+// must be a power of two, see bytequeue_init
+#ifndef MIDI_INPUT_QUEUE_LENGTH
+#    define MIDI_INPUT_QUEUE_LENGTH 256
+#endif
+
+STATIC_ASSERT((MIDI_INPUT_QUEUE_LENGTH & (MIDI_INPUT_QUEUE_LENGTH - 1)) == 0 && MIDI_INPUT_QUEUE_LENGTH <= 256, "MIDI_INPUT_QUEUE_LENGTH must be a power of two no larger than 256");
 
 typedef enum { IDLE, ONE_BYTE_MESSAGE = 1, TWO_BYTE_MESSAGE = 2, THREE_BYTE_MESSAGE = 3, SYSEX_MESSAGE } input_state_t;
 
@@ -1,6 +1,7 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "compiler_support.h"
 #include "keycodes.h"
 #include "eeprom.h"
@@ -68,10 +69,37 @@ STATIC_ASSERT((int64_t)(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (int64_t)(DYNAMIC_KEYM
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#define DYNAMIC_KEYMAP_ENCODER_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+// RAM copy of the keymap (and encoder map), in the same big endian layout as EEPROM.
+// Loaded with a single block read on first use, and written through on every update,
+// so that resolving a keypress never has to go out to an external EEPROM.
+static uint8_t keymap_shadow[DYNAMIC_KEYMAP_EEPROM_SIZE];
+#    ifdef ENCODER_MAP_ENABLE
+static uint8_t encoder_shadow[DYNAMIC_KEYMAP_ENCODER_EEPROM_SIZE];
+#    endif // ENCODER_MAP_ENABLE
+static bool shadow_loaded = false;
+
+static inline void dynamic_keymap_shadow_load(void) {
+    if (shadow_loaded) return;
+    eeprom_read_block(keymap_shadow, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, sizeof(keymap_shadow));
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(encoder_shadow, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, sizeof(encoder_shadow));
+#    endif // ENCODER_MAP_ENABLE
+    shadow_loaded = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
+
 void nvm_dynamic_keymap_erase(void) {
     // No-op, nvm_eeconfig_erase() will have already erased EEPROM if necessary.
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    // ...which the shadow copy must not outlive.
+    shadow_loaded = false;
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
 }
 
 void nvm_dynamic_keymap_macro_erase(void) {
@@ -84,16 +112,29 @@ static inline void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t
 
 uint16_t nvm_dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+    uint8_t *shadow = &keymap_shadow[(uintptr_t)dynamic_keymap_key_to_eeprom_address(layer, row, column) - DYNAMIC_KEYMAP_EEPROM_ADDR];
+    return (shadow[0] << 8) | shadow[1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
 }
 
 void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+    uint8_t *shadow = &keymap_shadow[(uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR];
+    if (shadow[0] == (uint8_t)(keycode >> 8) && shadow[1] == (uint8_t)(keycode & 0xFF)) return;
+    shadow[0] = (uint8_t)(keycode >> 8);
+    shadow[1] = (uint8_t)(keycode & 0xFF);
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
@@ -106,16 +147,29 @@ static void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t enc
 
 uint16_t nvm_dynamic_keymap_read_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+    uint8_t *shadow = &encoder_shadow[(uintptr_t)dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id) - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + (clockwise ? 0 : 2)];
+    return (shadow[0] << 8) | shadow[1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif // DYNAMIC_KEYMAP_RAM_SHADOW
 }
 
 void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
+#    ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+    uint8_t *shadow = &encoder_shadow[(uintptr_t)address - DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + (clockwise ? 0 : 2)];
+    if (shadow[0] == (uint8_t)(keycode >> 8) && shadow[1] == (uint8_t)(keycode & 0xFF)) return;
+    shadow[0] = (uint8_t)(keycode >> 8);
+    shadow[1] = (uint8_t)(keycode & 0xFF);
+#    endif // DYNAMIC_KEYMAP_RAM_SHADOW
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
@@ -123,12 +177,19 @@ void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool c
 #endif // ENCODER_MAP_ENABLE
 
 void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void    *source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
     for (uint32_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+            *target = keymap_shadow[offset + i];
+#else
             *target = eeprom_read_byte(source);
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
         } else {
             *target = 0x00;
         }
@@ -138,11 +199,17 @@ void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *dat
 }
 
 void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_EEPROM_SIZE;
     void    *target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+    dynamic_keymap_shadow_load();
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
     for (uint32_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
+#ifdef DYNAMIC_KEYMAP_RAM_SHADOW
+            keymap_shadow[offset + i] = *source;
+#endif // DYNAMIC_KEYMAP_RAM_SHADOW
             eeprom_update_byte(target, *source);
         }
         source++;
@@ -155,17 +222,13 @@ uint32_t nvm_dynamic_keymap_macro_size(void) {
 }
 
 void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void    *source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    // Read whatever lies within the macro buffer in one go, and zero the rest
+    uint32_t available = offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE ? DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - offset : 0;
+    uint32_t length    = size < available ? size : available;
+    if (length > 0) {
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
+    memset(data + length, 0x00, size - length);
 }
 
 void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
@@ -11,6 +11,7 @@
 #include "keycode_config.h"
 #include "send_string.h"
 #include "action_util.h"
+#include "bitwise.h"
 
 #if __has_include("autocorrect_data.h")
 #    include "autocorrect_data.h"
@@ -189,6 +190,23 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief Position of a buffered keycode in the child mask of a bitmap-indexed trie node
+ *
+ * @param keycode KC_A to KC_Z, KC_QUOTE or KC_SPC
+ * @return 0 to 25 for letters, 26 for quote and 27 for a word break
+ */
+static inline uint8_t autocorrect_child_bit(uint8_t keycode) {
+    switch (keycode) {
+        case KC_QUOTE:
+            return 26;
+        case KC_SPC:
+            return 27;
+        default:
+            return keycode - KC_A;
+    }
+}
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -285,7 +303,19 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
-        if (code & 64) { // Check for match in node with multiple children.
+        if (code == 64) { // Check for match in bitmap-indexed node with multiple children.
+            const uint8_t bit  = autocorrect_child_bit(key_i);
+            const uint8_t mask = pgm_read_byte(autocorrect_data + state + 1 + (bit >> 3));
+            if (!(mask & (1 << (bit & 7)))) return true;
+            // Links are stored in bit order, so the rank of the bit among the children is the index of its link.
+            uint8_t rank = bitpop(mask & ((1 << (bit & 7)) - 1));
+            for (uint8_t byte = 0; byte < (bit >> 3); byte++) {
+                rank += bitpop(pgm_read_byte(autocorrect_data + state + 1 + byte));
+            }
+            // Follow link to child node.
+            state += 5 + 2 * rank;
+            state = (pgm_read_byte(autocorrect_data + state) | pgm_read_byte(autocorrect_data + state + 1) << 8);
+        } else if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
             for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
                 if (!code) return true;
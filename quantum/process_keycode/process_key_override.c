@@ -244,150 +244,296 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Checks everything that is needed for `override` to activate on this key event. */
+static bool can_activate_override(const key_override_t *override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
+
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
+
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    if (!(no_trigger || trigger_down || last_key_down == override->trigger)) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
+
+    return true;
+}
+
+/** Activates `override`, which has passed can_activate_override(). Returns true if the key action for `keycode` should be sent */
+static bool activate_override(const key_override_t *override, const uint16_t keycode, const bool key_down, const bool is_mod, const uint8_t active_mods) {
+    const bool is_trigger   = override->trigger == keycode;
+    const bool trigger_down = is_trigger && key_down;
+    const bool no_trigger   = override->trigger == KC_NO;
+
+    key_override_printf("Activating override\n");
+
+    clear_active_override(false);
+
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
+
+    active_override                 = override;
+    active_override_trigger_is_down = true;
+
+    set_suppressed_override_mods(override->suppressed_mods);
+
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
         }
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
+
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
+            } else {
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
+            }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    return !trigger_down;
+}
+
+/* Candidate index
+ *
+ * Only overrides whose trigger is the key of the event, the last non-mod key pressed down, or KC_NO can ever
+ * activate. The overrides are therefore indexed by trigger, so that an event only examines those three runs
+ * instead of every override. Each entry holds the index of an override in the low byte and, in the high byte,
+ * the one-sided mods it requires, so that overrides whose mods are not down are skipped without looking at them.
+ * The runs are merged by index, which keeps the first override in the keymap taking precedence.
+ */
+#define INDEX_OVERRIDE(entry) ((uint8_t)(entry))
+#define INDEX_REQUIRED_MODS(entry) ((uint8_t)((entry) >> 8))
+#define ONE_SIDED_MODS(mods) (((mods) & 0b1111) | ((mods) >> 4))
+
+static uint16_t *override_index       = NULL;
+static uint16_t  override_index_count = 0;
+static bool      override_index_valid = false;
+
+static uint16_t override_index_trigger(uint16_t entry) {
+    return key_override_get(INDEX_OVERRIDE(entry))->trigger;
+}
+
+/** Builds the index, returns false if the overrides do not fit into it. */
+static bool build_override_index(void) {
+    const uint16_t count = key_override_count();
+
+    override_index_valid = true;
+    override_index       = key_override_index_storage();
+    override_index_count = 0;
+
+    if (count > key_override_count_raw() || count > UINT8_MAX) {
+        // Overrides provided at runtime may outnumber the ones in the keymap
+        override_index = NULL;
+        return false;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const key_override_t *const override = key_override_get(i);
+        if (override == NULL) {
+            break;
         }
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
+        uint8_t  required = (override->options & ko_option_one_mod) ? 0 : ONE_SIDED_MODS(override->trigger_mods);
+        uint16_t entry    = i | ((uint16_t)required << 8);
+
+        // Insertion sort by trigger, stable so that each run stays in keymap order
+        uint16_t j = override_index_count++;
+        for (; j > 0 && override_index_trigger(override_index[j - 1]) > override->trigger; j--) {
+            override_index[j] = override_index[j - 1];
         }
+        override_index[j] = entry;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    return true;
+}
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+void key_override_invalidate_index(void) {
+    override_index_valid = false;
+}
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
+/** Finds the first index entry for `trigger`, or the end of the run if there is none. */
+static uint16_t override_index_lower_bound(const uint16_t trigger) {
+    uint16_t low = 0, high = override_index_count;
+    while (low < high) {
+        uint16_t mid = (low + high) / 2;
+        if (override_index_trigger(override_index[mid]) < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
+    }
+    return low;
+}
 
-        key_override_printf("Activating override\n");
+typedef struct {
+    uint16_t position;
+    uint16_t trigger;
+} override_run_t;
 
-        clear_active_override(false);
+static override_run_t override_index_run(const uint16_t trigger) {
+    override_run_t run = {override_index_lower_bound(trigger), trigger};
+    return run;
+}
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+static bool override_run_done(const override_run_t *run) {
+    return run->position >= override_index_count || override_index_trigger(override_index[run->position]) != run->trigger;
+}
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+/** Iterates through the key overrides that could activate on this event and tries activating each, until it finds one that activates or runs out of candidates. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    *activated = false;
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    if (key_override_count() == 0) {
+        return true;
+    }
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
-            } else {
-                unregister_code(override->trigger);
-            }
-        }
+    if (!override_index_valid && !build_override_index()) {
+        key_override_printf("Key override index unavailable, checking every override\n");
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    if (override_index == NULL) {
+        for (uint8_t i = 0; i < key_override_count(); i++) {
+            const key_override_t *const override = key_override_get(i);
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+            // End of array
+            if (override == NULL) {
+                break;
+            }
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+            if (can_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+                *activated = true;
+                return activate_override(override, keycode, key_down, is_mod, active_mods);
+            }
         }
+        return true;
+    }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+    // The trigger of the event, the last non-mod key down (the same key for non-mod key down events) and KC_NO
+    override_run_t runs[3];
+    uint8_t        run_count = 0;
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+    runs[run_count++] = override_index_run(keycode);
+    if (last_key_down != keycode) {
+        runs[run_count++] = override_index_run(last_key_down);
+    }
+    if (keycode != KC_NO && last_key_down != KC_NO) {
+        runs[run_count++] = override_index_run(KC_NO);
+    }
+
+    const uint8_t active_one_sided_mods = ONE_SIDED_MODS(active_mods);
+
+    while (true) {
+        // Merge the runs by override index, so that the first override in the keymap wins
+        override_run_t *next = NULL;
+        for (uint8_t r = 0; r < run_count; r++) {
+            if (!override_run_done(&runs[r]) && (next == NULL || INDEX_OVERRIDE(override_index[runs[r].position]) < INDEX_OVERRIDE(override_index[next->position]))) {
+                next = &runs[r];
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+        }
+        if (next == NULL) {
+            break;
         }
 
-        *activated = true;
+        const uint16_t entry = override_index[next->position++];
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
-    }
+        if ((INDEX_REQUIRED_MODS(entry) & ~active_one_sided_mods) != 0) {
+            key_override_printf("Not activating override: Modifiers don't match\n");
+            continue;
+        }
 
-    *activated = false;
+        const key_override_t *const override = key_override_get(INDEX_OVERRIDE(entry));
+        if (can_activate_override(override, keycode, layer, key_down, is_mod, active_mods)) {
+            *activated = true;
+            return activate_override(override, keycode, key_down, is_mod, active_mods);
+        }
+    }
 
     return true;
 }
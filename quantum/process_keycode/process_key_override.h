@@ -99,6 +99,9 @@ void key_override_toggle(void);
 /** Returns whether key overrides are enabled */
 bool key_override_is_enabled(void);
 
+/** Rebuilds the index of key overrides by trigger before the next key event. Call after changing the trigger, mods or options of a key override at runtime */
+void key_override_invalidate_index(void);
+
 /** Handling of key overrides and its implemented keycodes */
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
 
@@ -31,6 +31,10 @@ static uint16_t active_td;
 
 static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
 
+// State and tapping term of `active_td`, kept along with it so that they need not be looked up on each scan
+static tap_dance_state_t *active_state;
+static uint16_t           active_tapping_term;
+
 static uint16_t last_tap_time;
 
 static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx, bool allocate) {
@@ -38,6 +42,10 @@ static tap_dance_state_t *tap_dance_get_or_allocate_state(uint8_t tap_dance_idx,
     if (tap_dance_idx >= tap_dance_count()) {
         return NULL;
     }
+    // Most lookups are for the active dance, whose state is still in use unless a callback reset it
+    if (active_td && QK_TAP_DANCE_GET_INDEX(active_td) == tap_dance_idx && active_state->in_use && active_state->index == tap_dance_idx) {
+        return active_state;
+    }
     // Search for a state already used for this keycode
     for (i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
         if (tap_dance_states[i].in_use && tap_dance_states[i].index == tap_dance_idx) {
@@ -215,6 +223,10 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
                 last_tap_time = timer_read();
                 process_tap_dance_action_on_each_tap(action, state);
                 active_td = state->finished ? 0 : keycode;
+                if (active_td) {
+                    active_state        = state;
+                    active_tapping_term = GET_TAPPING_TERM(keycode, &(keyrecord_t){});
+                }
             } else {
                 process_tap_dance_action_on_each_release(action, state);
                 if (state->finished) {
@@ -235,7 +247,7 @@ void tap_dance_task(void) {
     tap_dance_action_t *action;
     tap_dance_state_t  *state;
 
-    if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
+    if (!active_td || timer_elapsed(last_tap_time) <= active_tapping_term) return;
 
     action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
     state  = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
@@ -18,10 +18,13 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "action_util.h"
+#include "timer.h"
 #include "wait.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
@@ -150,11 +153,71 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
-void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+// Key and modifiers currently held down by burst typing
+static uint8_t burst_keycode = KC_NO;
+static uint8_t burst_mods    = 0;
+
+static void send_string_burst_release(void) {
+    if (burst_keycode == KC_NO && burst_mods == 0) return;
+    if (burst_keycode != KC_NO) del_key(burst_keycode);
+    del_mods(burst_mods);
+    burst_keycode = KC_NO;
+    burst_mods    = 0;
+    send_keyboard_report();
+}
+
+/* Presses keycode with mods, releasing the previously pressed key in the same report.
+ *
+ * Every report still presses exactly one new key, so the host sees the keys in
+ * order. A repeated key has to be released first, and so does the previous key
+ * when the modifiers change, so that the change never applies to it.
+ */
+static void send_string_burst_stroke(uint8_t keycode, uint8_t mods) {
+    if (keycode == burst_keycode || mods != burst_mods) {
+        if (burst_keycode != KC_NO) del_key(burst_keycode);
+        burst_keycode = KC_NO;
+        if (mods != burst_mods) {
+            del_mods(burst_mods);
+            add_mods(mods);
+            burst_mods = mods;
+        }
+        send_keyboard_report();
+    }
+
+    if (burst_keycode != KC_NO) del_key(burst_keycode);
+    add_key(keycode);
+    burst_keycode = keycode;
+    send_keyboard_report();
+}
+
+static void send_string_burst_char(char ascii_code) {
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        send_string_burst_release();
+        PLAY_SONG(bell_song);
+        return;
+    }
+#endif
+
+    uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    if (keycode == KC_NO) return;
+
+    uint8_t mods = 0;
+    if (PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code)) mods |= MOD_BIT(KC_LEFT_SHIFT);
+    if (PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code)) mods |= MOD_BIT(KC_RIGHT_ALT);
+
+    send_string_burst_stroke(keycode, mods);
+    if (PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code)) {
+        send_string_burst_stroke(KC_SPACE, 0);
+    }
+}
+
+static void send_string_impl(char (*getter)(void *), void *arg, uint8_t interval, bool burst) {
     while (1) {
         char ascii_code = getter(arg);
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
+            if (burst) send_string_burst_release();
             ascii_code = getter(arg);
 
             if (ascii_code == SS_TAP_CODE) {
@@ -187,10 +250,22 @@ void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t inte
 
             // if we had a delay that terminated with a null, we're done
             if (ascii_code == 0) break;
+        } else if (burst) {
+            send_string_burst_char(ascii_code);
         } else {
             send_char_with_delay(ascii_code, interval);
         }
     }
+
+    if (burst) send_string_burst_release();
+}
+
+void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+    send_string_impl(getter, arg, interval, false);
+}
+
+void send_string_burst_impl(char (*getter)(void *), void *arg) {
+    send_string_impl(getter, arg, 0, true);
 }
 
 typedef struct send_string_memory_state_t {
@@ -209,6 +284,11 @@ void send_string_with_delay(const char *string, uint8_t interval) {
     send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
 }
 
+void send_string_burst(const char *string) {
+    send_string_memory_state_t state = {string};
+    send_string_burst_impl(send_string_get_next_ram, &state);
+}
+
 void send_char(char ascii_code) {
     send_char_with_delay(ascii_code, TAP_CODE_DELAY);
 }
@@ -325,4 +405,202 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_memory_state_t state = {string};
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
+
+void send_string_burst_P(const char *string) {
+    send_string_memory_state_t state = {string};
+    send_string_burst_impl(send_string_get_next_progmem, &state);
+}
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+typedef struct send_string_action_t {
+    uint8_t keycode;
+    bool    pressed;
+} send_string_action_t;
+
+// Queued strings, each stored as its interval followed by the null terminated string
+static uint8_t  async_buffer[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t async_head   = 0;
+static uint16_t async_tail   = 0;
+static bool     async_active = false;
+static uint8_t  async_interval;
+
+// Key presses and releases of the character being typed, at most shift, AltGr, the key and a dead key space
+static send_string_action_t async_actions[8];
+static uint8_t              async_action_count = 0;
+static uint8_t              async_action_index = 0;
+
+static uint16_t async_wait_timer;
+static uint16_t async_wait_ms = 0;
+
+// Keys pressed and not yet released by queued strings, including SS_DOWN() of earlier characters, one bit per keycode
+static uint8_t async_held[32];
+
+static uint16_t send_string_async_free(void) {
+    return SEND_STRING_ASYNC_BUFFER_SIZE - 1 - ((async_head + SEND_STRING_ASYNC_BUFFER_SIZE - async_tail) % SEND_STRING_ASYNC_BUFFER_SIZE);
+}
+
+static void send_string_async_push(uint8_t data) {
+    async_buffer[async_head] = data;
+    async_head               = (async_head + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+}
+
+static char send_string_async_pop(void) {
+    // Strings are only ever queued whole, so running dry means the terminator has been read
+    if (async_tail == async_head) return 0;
+    char ret   = async_buffer[async_tail];
+    async_tail = (async_tail + 1) % SEND_STRING_ASYNC_BUFFER_SIZE;
+    return ret;
+}
+
+static bool send_string_async_queue(char (*getter)(void *), void *arg, uint16_t length, uint8_t interval) {
+    if (length == 0) return true;
+    if (length + 2 > send_string_async_free()) return false;
+
+    send_string_async_push(interval);
+    for (uint16_t i = 0; i < length; i++) {
+        send_string_async_push(getter(arg));
+    }
+    send_string_async_push(0);
+    return true;
+}
+
+static void send_string_async_add_action(uint8_t keycode, bool pressed) {
+    async_actions[async_action_count++] = (send_string_action_t){.keycode = keycode, .pressed = pressed};
+}
+
+static void send_string_async_add_char(char ascii_code) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) send_string_async_add_action(KC_LEFT_SHIFT, true);
+    if (is_altgred) send_string_async_add_action(KC_RIGHT_ALT, true);
+    send_string_async_add_action(keycode, true);
+    send_string_async_add_action(keycode, false);
+    if (is_altgred) send_string_async_add_action(KC_RIGHT_ALT, false);
+    if (is_shifted) send_string_async_add_action(KC_LEFT_SHIFT, false);
+    if (is_dead) {
+        send_string_async_add_action(KC_SPACE, true);
+        send_string_async_add_action(KC_SPACE, false);
+    }
+}
+
+static void send_string_async_wait(uint16_t ms) {
+    async_wait_timer = timer_read();
+    async_wait_ms    = ms;
+}
+
+// Turns the next character or keycode sequence of the current string into actions
+static void send_string_async_parse_next(void) {
+    char ascii_code = send_string_async_pop();
+    if (!ascii_code) {
+        async_active = false;
+        return;
+    }
+
+    if (ascii_code == SS_QMK_PREFIX) {
+        ascii_code = send_string_async_pop();
+
+        if (ascii_code == SS_TAP_CODE) {
+            uint8_t keycode = send_string_async_pop();
+            send_string_async_add_action(keycode, true);
+            send_string_async_add_action(keycode, false);
+        } else if (ascii_code == SS_DOWN_CODE) {
+            send_string_async_add_action(send_string_async_pop(), true);
+        } else if (ascii_code == SS_UP_CODE) {
+            send_string_async_add_action(send_string_async_pop(), false);
+        } else if (ascii_code == SS_DELAY_CODE) {
+            uint16_t ms = 0;
+            ascii_code  = send_string_async_pop();
+
+            while (isdigit(ascii_code)) {
+                ms *= 10;
+                ms += ascii_code - '0';
+                ascii_code = send_string_async_pop();
+            }
+
+            send_string_async_wait(ms + async_interval);
+
+            // if we had a delay that terminated with a null, we're done
+            if (ascii_code == 0) async_active = false;
+        }
+    } else {
+        send_string_async_add_char(ascii_code);
+    }
+}
+
+void send_string_task(void) {
+    if (async_wait_ms) {
+        if (timer_elapsed(async_wait_timer) < async_wait_ms) return;
+        async_wait_ms = 0;
+    }
+
+    // Fetch whatever is typed next, skipping over anything that doesn't press or release a key
+    while (async_action_index == async_action_count) {
+        async_action_index = async_action_count = 0;
+
+        if (!async_active) {
+            if (async_tail == async_head) return;
+            async_interval = send_string_async_pop();
+            async_active   = true;
+        }
+        send_string_async_parse_next();
+        if (async_wait_ms) return;
+    }
+
+    // One report per task, the next one no earlier than the interval
+    send_string_action_t action = async_actions[async_action_index++];
+    if (action.pressed) {
+        async_held[action.keycode / 8] |= 1 << (action.keycode % 8);
+        register_code(action.keycode);
+    } else {
+        async_held[action.keycode / 8] &= ~(1 << (action.keycode % 8));
+        unregister_code(action.keycode);
+    }
+    send_string_async_wait(async_interval);
+}
+
+bool send_string_async_is_busy(void) {
+    return async_active || async_tail != async_head || async_action_index < async_action_count || async_wait_ms;
+}
+
+void send_string_async_cancel(void) {
+    // Release every key still held, whether by the character being typed or by an earlier SS_DOWN()
+    for (uint16_t keycode = 0; keycode < 256; keycode++) {
+        if (async_held[keycode / 8] & (1 << (keycode % 8))) {
+            unregister_code(keycode);
+        }
+    }
+    memset(async_held, 0, sizeof(async_held));
+
+    async_head = async_tail = 0;
+    async_active            = false;
+    async_action_index = async_action_count = 0;
+    async_wait_ms                           = 0;
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_queue(send_string_get_next_ram, &state, strlen(string), interval);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    return send_string_async_queue(send_string_get_next_progmem, &state, strlen_P(string), interval);
+}
+#    endif
+#endif // SEND_STRING_ASYNC_ENABLE
@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -46,6 +47,15 @@ extern const uint8_t ascii_to_keycode_lut[128];
     | ((h) ? 1 : 0) << 7 )
 // clang-format on
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+/**
+ * \brief Size, in bytes, of the queue used by `send_string_async()`. Each queued string takes its length plus two bytes.
+ */
+#    ifndef SEND_STRING_ASYNC_BUFFER_SIZE
+#        define SEND_STRING_ASYNC_BUFFER_SIZE 128
+#    endif
+#endif
+
 /**
  * \brief Type out a string of ASCII characters.
  *
@@ -169,4 +179,104 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+/**
+ * \brief Type out a string of ASCII characters using as few keyboard reports as possible.
+ *
+ * Instead of a press and a release report per character, each report presses the next key and releases the previous
+ * one. Only a repeated key or a change of modifiers needs an extra report, so typical text takes about half as many
+ * reports as `send_string()`. There is no delay between reports, so hosts or applications that drop fast input may miss
+ * characters.
+ *
+ * \param string The string to type out.
+ */
+void send_string_burst(const char *string);
+
+#if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Type out a PROGMEM string of ASCII characters using as few keyboard reports as possible.
+ *
+ * On ARM devices, this function is simply an alias for `send_string_burst(string)`.
+ *
+ * \param string The string to type out.
+ */
+void send_string_burst_P(const char *string);
+#else
+#    define send_string_burst_P(string) send_string_burst(string)
+#endif
+
+/**
+ * \brief Shortcut macro for send_string_burst_P(PSTR(string)).
+ *
+ * On ARM devices, this define evaluates to send_string_burst(string).
+ */
+#define SEND_STRING_BURST(string) send_string_burst_P(PSTR(string))
+
+/**
+ * \brief Burst typing counterpart of `send_string_with_delay_impl()`.
+ */
+void send_string_burst_impl(char (*getter)(void *), void *arg);
+
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out. It is copied, so it does not need to outlive the call.
+ *
+ * \return `false` if there is not enough room in the queue, in which case nothing is queued.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background, with a delay between each key event.
+ *
+ * Unlike `send_string_with_delay()`, this returns immediately. Key events are sent one per `send_string_task()`, so
+ * matrix scanning and every other task keep running while the string is typed, and intervals and `SS_DELAY()` are
+ * waited out between tasks instead of blocking.
+ *
+ * \param string The string to type out. It is copied, so it does not need to outlive the call.
+ * \param interval The amount of time, in milliseconds, to wait between key events.
+ *
+ * \return `false` if there is not enough room in the queue, in which case nothing is queued.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background, with a delay between each key event.
+ *
+ * On ARM devices, this function is simply an alias for `send_string_async_with_delay(string, interval)`.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait between key events.
+ *
+ * \return `false` if there is not enough room in the queue, in which case nothing is queued.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), TAP_CODE_DELAY), the same delay as `send_string_async()`.
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), TAP_CODE_DELAY)
+
+/**
+ * \brief Check whether queued strings are still being typed.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Drop every queued string, releasing any key it holds, including ones held by an earlier `SS_DOWN()`.
+ */
+void send_string_async_cancel(void);
+
+/**
+ * \brief Sends the next key event of the queued strings, if it is due. Called from `quantum_task()`.
+ */
+void send_string_task(void);
+#endif
+
 /** \} */
@@ -34,7 +34,7 @@ sequencer_config_t sequencer_config = {
     SQ_RES_4, // resolution
 };
 
-sequencer_state_t sequencer_internal_state = {0, 0, 0, 0, SEQUENCER_PHASE_ATTACK};
+sequencer_state_t sequencer_internal_state = {0, 0, 0, 0, SEQUENCER_PHASE_ATTACK, 0};
 
 bool is_sequencer_on(void) {
     return sequencer_config.enabled;
@@ -47,6 +47,7 @@ void sequencer_on(void) {
     sequencer_internal_state.current_step  = 0;
     sequencer_internal_state.timer         = timer_read();
     sequencer_internal_state.phase         = SEQUENCER_PHASE_ATTACK;
+    sequencer_internal_state.step_time     = timer_read32();
 }
 
 void sequencer_off(void) {
@@ -193,44 +194,65 @@ void sequencer_phase_attack(void) {
         sequencer_internal_state.timer = timer_read();
     }
 
-    if (timer_elapsed(sequencer_internal_state.timer) < sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
-        return;
-    }
+    // Without a throttle, the notes of all tracks go out in the same task, so in the same USB transfer
+    do {
+        if (timer_elapsed(sequencer_internal_state.timer) < sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
+            return;
+        }
 
 #if defined(MIDI_ENABLE) || defined(MIDI_MOCKED)
-    if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
-        process_midi_basic_noteon(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
-    }
+        if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
+            process_midi_basic_noteon(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
+        }
 #endif
 
-    if (sequencer_internal_state.current_track < SEQUENCER_TRACKS - 1) {
-        sequencer_internal_state.current_track++;
-    } else {
-        sequencer_internal_state.phase = SEQUENCER_PHASE_RELEASE;
-    }
+        if (sequencer_internal_state.current_track < SEQUENCER_TRACKS - 1) {
+            sequencer_internal_state.current_track++;
+        } else {
+            sequencer_internal_state.phase = SEQUENCER_PHASE_RELEASE;
+            return;
+        }
+    } while (SEQUENCER_TRACK_THROTTLE == 0);
 }
 
 void sequencer_phase_release(void) {
-    if (timer_elapsed(sequencer_internal_state.timer) < SEQUENCER_PHASE_RELEASE_TIMEOUT + sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
-        return;
-    }
+    do {
+        if (timer_elapsed(sequencer_internal_state.timer) < SEQUENCER_PHASE_RELEASE_TIMEOUT + sequencer_internal_state.current_track * SEQUENCER_TRACK_THROTTLE) {
+            return;
+        }
 #if defined(MIDI_ENABLE) || defined(MIDI_MOCKED)
-    if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
-        process_midi_basic_noteoff(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
-    }
+        if (is_sequencer_step_on_for_track(sequencer_internal_state.current_step, sequencer_internal_state.current_track)) {
+            process_midi_basic_noteoff(midi_compute_note(sequencer_config.track_notes[sequencer_internal_state.current_track]));
+        }
 #endif
-    if (sequencer_internal_state.current_track > 0) {
-        sequencer_internal_state.current_track--;
-    } else {
-        sequencer_internal_state.phase = SEQUENCER_PHASE_PAUSE;
-    }
+        if (sequencer_internal_state.current_track > 0) {
+            sequencer_internal_state.current_track--;
+        } else {
+            sequencer_internal_state.phase = SEQUENCER_PHASE_PAUSE;
+            return;
+        }
+    } while (SEQUENCER_TRACK_THROTTLE == 0);
 }
 
 void sequencer_phase_pause(void) {
-    if (timer_elapsed(sequencer_internal_state.timer) < sequencer_get_step_duration()) {
+    /**
+     * The next step is due one step duration after the current one was due, rather than after it was
+     * played, so that the time it takes the task to come around doesn't add up from step to step.
+     */
+    uint16_t step_duration = sequencer_get_step_duration();
+    uint32_t step_time     = sequencer_internal_state.step_time + step_duration;
+
+    uint32_t now = timer_read32();
+    if (!timer_expired32(now, step_time)) {
         return;
     }
 
+    // When a whole step late, e.g. because the tempo went up, start over from now rather than rushing through the missed steps
+    if (TIMER_DIFF_32(now, step_time) >= step_duration) {
+        step_time = now;
+    }
+
+    sequencer_internal_state.step_time    = step_time;
     sequencer_internal_state.current_step = (sequencer_internal_state.current_step + 1) % SEQUENCER_STEPS;
     sequencer_internal_state.phase        = SEQUENCER_PHASE_ATTACK;
 }
@@ -29,6 +29,7 @@
 #    define SEQUENCER_TRACKS 8
 #endif
 
+// Delay between the notes of the tracks of a step, 0 sends them all at once
 #ifndef SEQUENCER_TRACK_THROTTLE
 #    define SEQUENCER_TRACK_THROTTLE 3
 #endif
@@ -76,8 +77,9 @@ typedef struct {
     uint8_t           active_tracks;
     uint8_t           current_track;
     uint8_t           current_step;
-    uint16_t          timer;
+    uint16_t          timer; // when the first track of the current step was attacked
     sequencer_phase_t phase;
+    uint32_t          step_time; // when the current step was due
 } sequencer_state_t;
 
 extern sequencer_config_t sequencer_config;
@@ -16,8 +16,10 @@
 
 #include "midi_mock.h"
 
-uint16_t last_noteon  = 0;
-uint16_t last_noteoff = 0;
+uint16_t last_noteon   = 0;
+uint16_t last_noteoff  = 0;
+uint16_t noteon_count  = 0;
+uint16_t noteoff_count = 0;
 
 uint16_t midi_compute_note(uint16_t keycode) {
     return keycode;
@@ -25,8 +27,10 @@ uint16_t midi_compute_note(uint16_t keycode) {
 
 void process_midi_basic_noteon(uint16_t note) {
     last_noteon = note;
+    noteon_count++;
 }
 
 void process_midi_basic_noteoff(uint16_t note) {
     last_noteoff = note;
+    noteoff_count++;
 }
@@ -20,6 +20,8 @@
 
 extern uint16_t last_noteon;
 extern uint16_t last_noteoff;
+extern uint16_t noteon_count;
+extern uint16_t noteoff_count;
 
 uint16_t midi_compute_note(uint16_t keycode);
 void     process_midi_basic_noteon(uint16_t note);
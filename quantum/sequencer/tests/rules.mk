@@ -10,3 +10,12 @@ sequencer_SRC := \
 	$(QUANTUM_PATH)/sequencer/sequencer.c \
 	$(PLATFORM_PATH)/timer.c \
 	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+sequencer_unthrottled_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=1 -DNO_DEBUG -DMIDI_MOCKED -DSEQUENCER_TRACK_THROTTLE=0
+
+sequencer_unthrottled_SRC := \
+	$(QUANTUM_PATH)/sequencer/tests/midi_mock.c \
+	$(QUANTUM_PATH)/sequencer/tests/sequencer_unthrottled_tests.cpp \
+	$(QUANTUM_PATH)/sequencer/sequencer.c \
+	$(PLATFORM_PATH)/timer.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
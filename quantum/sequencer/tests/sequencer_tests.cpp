@@ -23,8 +23,9 @@ extern "C" {
 }
 
 extern "C" {
-void set_time(uint32_t t);
-void advance_time(uint32_t ms);
+void     set_time(uint32_t t);
+void     advance_time(uint32_t ms);
+uint32_t timer_read32(void);
 }
 
 class SequencerTest : public ::testing::Test {
@@ -47,9 +48,13 @@ class SequencerTest : public ::testing::Test {
         state_copy.current_track = sequencer_internal_state.current_track;
         state_copy.current_step  = sequencer_internal_state.current_step;
         state_copy.timer         = sequencer_internal_state.timer;
+        state_copy.phase         = sequencer_internal_state.phase;
+        state_copy.step_time     = sequencer_internal_state.step_time;
 
-        last_noteon  = 0;
-        last_noteoff = 0;
+        last_noteon   = 0;
+        last_noteoff  = 0;
+        noteon_count  = 0;
+        noteoff_count = 0;
 
         set_time(0);
     }
@@ -72,6 +77,8 @@ class SequencerTest : public ::testing::Test {
         sequencer_internal_state.current_track = state_copy.current_track;
         sequencer_internal_state.current_step  = state_copy.current_step;
         sequencer_internal_state.timer         = state_copy.timer;
+        sequencer_internal_state.phase         = state_copy.phase;
+        sequencer_internal_state.step_time     = state_copy.step_time;
     }
 
     sequencer_config_t config_copy;
@@ -590,3 +597,79 @@ TEST_F(SequencerTest, TestMatrixScanSequencerShouldLoopOnceSequenceIsOver) {
     EXPECT_EQ(sequencer_internal_state.current_track, 1);
     EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_ATTACK);
 }
+
+/**
+ * Runs the sequencer for `steps` steps, calling the task every 1 to `max_gap` ms as if the rest of the
+ * keyboard was busy, and checks that each step starts within `max_gap` ms of when it is due.
+ */
+void expectStepsOnTime(uint16_t steps, uint32_t max_gap) {
+    const uint32_t step_duration = sequencer_get_step_duration();
+    uint32_t       random        = 1;
+    uint16_t       step          = 0;
+
+    sequencer_on();
+    sequencer_task();
+    while (step < steps) {
+        random = random * 1103515245 + 12345;
+        advance_time(1 + (random >> 16) % max_gap);
+
+        uint8_t previous_step = sequencer_get_current_step();
+        sequencer_task();
+        if (sequencer_get_current_step() != previous_step) {
+            step++;
+            uint32_t due = (uint32_t)step * step_duration;
+            EXPECT_GE(timer_read32(), due) << "step " << step;
+            EXPECT_LE(timer_read32(), due + max_gap) << "step " << step;
+        }
+    }
+}
+
+TEST_F(SequencerTest, TestStepsDoNotDriftUnderLoad) {
+    setUpMatrixScanSequencerTest();
+
+    // One 8th triplet at tempo=120 lasts 166.67ms
+    sequencer_config.resolution = SQ_RES_8T;
+    expectStepsOnTime(4 * SEQUENCER_STEPS, 7);
+}
+
+TEST_F(SequencerTest, TestStepsDoNotDriftWithoutLoad) {
+    setUpMatrixScanSequencerTest();
+
+    sequencer_config.tempo      = 97;
+    sequencer_config.resolution = SQ_RES_4T;
+    expectStepsOnTime(4 * SEQUENCER_STEPS, 1);
+}
+
+TEST_F(SequencerTest, TestAllTracksOfStepAreAttackedUnderLoad) {
+    setUpMatrixScanSequencerTest();
+
+    sequencer_config.steps[0]              = 0xFF;
+    sequencer_internal_state.current_step  = 0;
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_ATTACK;
+
+    uint32_t random = 1;
+    while (sequencer_internal_state.phase == SEQUENCER_PHASE_ATTACK) {
+        sequencer_task();
+        random = random * 1103515245 + 12345;
+        advance_time(1 + (random >> 16) % 7);
+    }
+    EXPECT_EQ(noteon_count, SEQUENCER_TRACKS);
+    EXPECT_EQ(noteoff_count, 0);
+}
+
+TEST_F(SequencerTest, TestSkipsMissedStepsWhenLate) {
+    setUpMatrixScanSequencerTest();
+
+    sequencer_internal_state.current_step  = 0;
+    sequencer_internal_state.current_track = 0;
+    sequencer_internal_state.phase         = SEQUENCER_PHASE_PAUSE;
+    sequencer_internal_state.step_time     = 0;
+
+    // Three steps late
+    advance_time(3 * 125 + 10);
+
+    sequencer_task();
+    EXPECT_EQ(sequencer_internal_state.current_step, 1);
+    EXPECT_EQ(sequencer_internal_state.step_time, 3 * 125 + 10);
+}
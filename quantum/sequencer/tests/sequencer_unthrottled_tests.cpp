@@ -0,0 +1,76 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "sequencer.h"
+#include "midi_mock.h"
+#include "quantum/quantum_keycodes.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+class SequencerUnthrottledTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(0);
+
+        sequencer_config.tempo      = 120;
+        sequencer_config.resolution = SQ_RES_16;
+        for (int i = 0; i < SEQUENCER_TRACKS; i++) {
+            sequencer_config.track_notes[i] = QK_MIDI_NOTE_C_0 + i;
+        }
+        for (int i = 0; i < SEQUENCER_STEPS; i++) {
+            sequencer_config.steps[i] = 0;
+        }
+        sequencer_config.steps[0] = (1 << 0) + (1 << 1) + (1 << 3);
+        sequencer_on();
+
+        last_noteon   = 0;
+        last_noteoff  = 0;
+        noteon_count  = 0;
+        noteoff_count = 0;
+    }
+};
+
+TEST_F(SequencerUnthrottledTest, TestAttacksAllTracksAtOnce) {
+    sequencer_task();
+    EXPECT_EQ(noteon_count, 3);
+    EXPECT_EQ(last_noteon, QK_MIDI_NOTE_C_0 + 3);
+    EXPECT_EQ(noteoff_count, 0);
+    EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_RELEASE);
+}
+
+TEST_F(SequencerUnthrottledTest, TestReleasesAllTracksAtOnce) {
+    sequencer_task();
+
+    advance_time(SEQUENCER_PHASE_RELEASE_TIMEOUT - 1);
+    sequencer_task();
+    EXPECT_EQ(noteoff_count, 0);
+
+    advance_time(1);
+    sequencer_task();
+    EXPECT_EQ(noteoff_count, 3);
+    EXPECT_EQ(last_noteoff, QK_MIDI_NOTE_C_0);
+    EXPECT_EQ(sequencer_internal_state.phase, SEQUENCER_PHASE_PAUSE);
+}
+
+TEST_F(SequencerUnthrottledTest, TestNextStepIsDueOneStepAfterTheFirst) {
+    sequencer_task();
+    advance_time(SEQUENCER_PHASE_RELEASE_TIMEOUT);
+    sequencer_task();
+
+    // One 16th at tempo=120 lasts 125ms
+    advance_time(125 - SEQUENCER_PHASE_RELEASE_TIMEOUT - 1);
+    sequencer_task();
+    EXPECT_EQ(sequencer_get_current_step(), 0);
+
+    advance_time(1);
+    sequencer_task();
+    EXPECT_EQ(sequencer_get_current_step(), 1);
+    EXPECT_EQ(noteon_count, 3);
+}
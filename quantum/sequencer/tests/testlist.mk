@@ -1 +1,2 @@
 TEST_LIST += sequencer
+TEST_LIST += sequencer_unthrottled
@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "spsc_queue.h"
+
+// Single byte indices load and store atomically on every supported MCU, so the
+// only thing to get right is the ordering against the data they cover
+static inline uint8_t index_load(const uint8_t *index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static inline void index_store(uint8_t *index, uint8_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+void spsc_queue_init(spsc_queue_t *queue, uint8_t *data, uint16_t size) {
+    queue->data = data;
+    queue->mask = size - 1;
+    queue->head = 0;
+    queue->tail = 0;
+}
+
+uint8_t spsc_queue_length(spsc_queue_t *queue) {
+    return (index_load(&queue->head) - index_load(&queue->tail)) & queue->mask;
+}
+
+uint8_t spsc_queue_space(spsc_queue_t *queue) {
+    return queue->mask - spsc_queue_length(queue);
+}
+
+uint8_t spsc_queue_write(spsc_queue_t *queue, const uint8_t *items, uint8_t count) {
+    uint8_t head  = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    uint8_t space = (index_load(&queue->tail) - head - 1) & queue->mask;
+    if (count > space) {
+        count = space;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        queue->data[(head + i) & queue->mask] = items[i];
+    }
+    index_store(&queue->head, (head + count) & queue->mask);
+    return count;
+}
+
+bool spsc_queue_push(spsc_queue_t *queue, uint8_t item) {
+    return spsc_queue_write(queue, &item, 1) == 1;
+}
+
+uint8_t spsc_queue_read(spsc_queue_t *queue, uint8_t *items, uint8_t count) {
+    uint8_t tail      = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    uint8_t available = (index_load(&queue->head) - tail) & queue->mask;
+    if (count > available) {
+        count = available;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        items[i] = queue->data[(tail + i) & queue->mask];
+    }
+    index_store(&queue->tail, (tail + count) & queue->mask);
+    return count;
+}
+
+bool spsc_queue_pop(spsc_queue_t *queue, uint8_t *item) {
+    return spsc_queue_read(queue, item, 1) == 1;
+}
+
+uint8_t spsc_queue_peek(spsc_queue_t *queue, uint8_t index) {
+    return queue->data[(__atomic_load_n(&queue->tail, __ATOMIC_RELAXED) + index) & queue->mask];
+}
+
+void spsc_queue_skip(spsc_queue_t *queue, uint8_t count) {
+    uint8_t tail      = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    uint8_t available = (index_load(&queue->head) - tail) & queue->mask;
+    if (count > available) {
+        count = available;
+    }
+    index_store(&queue->tail, (tail + count) & queue->mask);
+}
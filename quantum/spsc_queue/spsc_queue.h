@@ -0,0 +1,96 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * \file
+ *
+ * \defgroup spsc_queue Single Producer Single Consumer Queue
+ *
+ * A byte queue that one producer, e.g. an interrupt handler, and one consumer,
+ * e.g. a task on the main loop, can use at the same time without disabling
+ * interrupts. Each side only writes its own index, and publishes it with
+ * release semantics after the data it covers.
+ * \{
+ */
+
+typedef struct {
+    uint8_t *data;
+    uint8_t  mask; // size of the data array minus one
+    uint8_t  head; // next slot to write, only written by the producer
+    uint8_t  tail; // next slot to read, only written by the consumer
+} spsc_queue_t;
+
+/**
+ * \brief Initialize an empty queue.
+ *
+ * \param data The storage for the queue.
+ * \param size The size of the storage, a power of two from 2 to 256. The queue holds up to `size - 1` bytes.
+ */
+void spsc_queue_init(spsc_queue_t *queue, uint8_t *data, uint16_t size);
+
+/**
+ * \brief Get the number of bytes in the queue.
+ *
+ * Safe to call from either side. The consumer may see it grow, the producer may see it shrink.
+ */
+uint8_t spsc_queue_length(spsc_queue_t *queue);
+
+/**
+ * \brief Get the number of bytes that can be written before the queue is full.
+ */
+uint8_t spsc_queue_space(spsc_queue_t *queue);
+
+/**
+ * \brief Add a byte to the queue. Producer only.
+ *
+ * \return `false` if the queue is full.
+ */
+bool spsc_queue_push(spsc_queue_t *queue, uint8_t item);
+
+/**
+ * \brief Add as many of the given bytes to the queue as fit. Producer only.
+ *
+ * \return The number of bytes added.
+ */
+uint8_t spsc_queue_write(spsc_queue_t *queue, const uint8_t *items, uint8_t count);
+
+/**
+ * \brief Remove the oldest byte from the queue. Consumer only.
+ *
+ * \return `false` if the queue is empty.
+ */
+bool spsc_queue_pop(spsc_queue_t *queue, uint8_t *item);
+
+/**
+ * \brief Remove up to `count` of the oldest bytes from the queue. Consumer only.
+ *
+ * \return The number of bytes removed.
+ */
+uint8_t spsc_queue_read(spsc_queue_t *queue, uint8_t *items, uint8_t count);
+
+/**
+ * \brief Get the byte at `index` from the oldest one without removing it. Consumer only.
+ *
+ * \param index Must be less than `spsc_queue_length()`.
+ */
+uint8_t spsc_queue_peek(spsc_queue_t *queue, uint8_t index);
+
+/**
+ * \brief Drop up to `count` of the oldest bytes. Consumer only.
+ */
+void spsc_queue_skip(spsc_queue_t *queue, uint8_t count);
+
+/** \} */
+
+#ifdef __cplusplus
+}
+#endif
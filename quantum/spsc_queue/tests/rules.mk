@@ -0,0 +1,6 @@
+spsc_queue_INC := $(QUANTUM_PATH)/spsc_queue
+
+spsc_queue_SRC := \
+	$(QUANTUM_PATH)/spsc_queue/tests/spsc_queue_tests.cpp \
+	$(QUANTUM_PATH)/spsc_queue/spsc_queue.c \
+	$(QUANTUM_PATH)/midi/bytequeue/bytequeue.c
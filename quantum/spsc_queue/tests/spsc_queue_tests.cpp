@@ -0,0 +1,167 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spsc_queue.h"
+#include "quantum/midi/bytequeue/bytequeue.h"
+}
+
+class SpscQueueTest : public ::testing::Test {};
+
+TEST_F(SpscQueueTest, HoldsOneLessThanItsSize) {
+    uint8_t      data[8];
+    spsc_queue_t queue;
+    spsc_queue_init(&queue, data, sizeof(data));
+
+    EXPECT_EQ(spsc_queue_length(&queue), 0);
+    EXPECT_EQ(spsc_queue_space(&queue), 7);
+    for (uint8_t i = 0; i < 7; i++) {
+        EXPECT_TRUE(spsc_queue_push(&queue, i));
+    }
+    EXPECT_FALSE(spsc_queue_push(&queue, 7));
+    EXPECT_EQ(spsc_queue_length(&queue), 7);
+    EXPECT_EQ(spsc_queue_space(&queue), 0);
+
+    uint8_t item;
+    for (uint8_t i = 0; i < 7; i++) {
+        EXPECT_TRUE(spsc_queue_pop(&queue, &item));
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_FALSE(spsc_queue_pop(&queue, &item));
+}
+
+TEST_F(SpscQueueTest, BulkWriteAndReadWrapAround) {
+    uint8_t      data[8];
+    spsc_queue_t queue;
+    spsc_queue_init(&queue, data, sizeof(data));
+
+    const uint8_t items[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    uint8_t       out[10];
+
+    EXPECT_EQ(spsc_queue_write(&queue, items, 5), 5);
+    EXPECT_EQ(spsc_queue_read(&queue, out, 3), 3);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[2], 3);
+
+    // Only five fit, across the end of the storage
+    EXPECT_EQ(spsc_queue_write(&queue, &items[5], 5), 5);
+    EXPECT_EQ(spsc_queue_write(&queue, items, 1), 0);
+    EXPECT_EQ(spsc_queue_length(&queue), 7);
+
+    EXPECT_EQ(spsc_queue_read(&queue, out, sizeof(out)), 7);
+    for (uint8_t i = 0; i < 7; i++) {
+        EXPECT_EQ(out[i], i + 4);
+    }
+    EXPECT_EQ(spsc_queue_read(&queue, out, sizeof(out)), 0);
+}
+
+TEST_F(SpscQueueTest, PeekAndSkip) {
+    uint8_t      data[4];
+    spsc_queue_t queue;
+    spsc_queue_init(&queue, data, sizeof(data));
+
+    const uint8_t items[] = {10, 20, 30};
+    spsc_queue_write(&queue, items, sizeof(items));
+    EXPECT_EQ(spsc_queue_peek(&queue, 0), 10);
+    EXPECT_EQ(spsc_queue_peek(&queue, 2), 30);
+
+    spsc_queue_skip(&queue, 2);
+    EXPECT_EQ(spsc_queue_length(&queue), 1);
+    EXPECT_EQ(spsc_queue_peek(&queue, 0), 30);
+
+    spsc_queue_skip(&queue, 5);
+    EXPECT_EQ(spsc_queue_length(&queue), 0);
+}
+
+TEST_F(SpscQueueTest, FullSizeQueue) {
+    uint8_t      data[256];
+    spsc_queue_t queue;
+    spsc_queue_init(&queue, data, sizeof(data));
+
+    std::vector<uint8_t> items(255);
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i] = i;
+    }
+    EXPECT_EQ(spsc_queue_write(&queue, items.data(), 255), 255);
+    EXPECT_EQ(spsc_queue_length(&queue), 255);
+    EXPECT_FALSE(spsc_queue_push(&queue, 0));
+
+    std::vector<uint8_t> out(255);
+    EXPECT_EQ(spsc_queue_read(&queue, out.data(), 255), 255);
+    EXPECT_EQ(out, items);
+}
+
+TEST_F(SpscQueueTest, ByteQueueUsesTheSameStorage) {
+    uint8_t     data[16];
+    byteQueue_t queue;
+    bytequeue_init(&queue, data, sizeof(data));
+
+    const uint8_t items[] = {0x90, 0x3C, 0x7F};
+    EXPECT_EQ(bytequeue_enqueue_many(&queue, items, sizeof(items)), 3);
+    EXPECT_TRUE(bytequeue_enqueue(&queue, 0x80));
+    EXPECT_EQ(bytequeue_length(&queue), 4);
+    EXPECT_EQ(bytequeue_get(&queue, 1), 0x3C);
+
+    bytequeue_remove(&queue, 1);
+    uint8_t out[4];
+    EXPECT_EQ(bytequeue_dequeue(&queue, out, sizeof(out)), 3);
+    EXPECT_EQ(out[0], 0x3C);
+    EXPECT_EQ(out[2], 0x80);
+}
+
+// A producer and a consumer thread stream a counting sequence through a small queue in random sized chunks
+static void stress(uint16_t size, uint32_t total) {
+    std::vector<uint8_t> data(size);
+    spsc_queue_t         queue;
+    spsc_queue_init(&queue, data.data(), size);
+
+    std::thread producer([&]() {
+        std::mt19937                       generator(1);
+        std::uniform_int_distribution<int> chunk(1, size);
+        uint8_t                            items[256];
+        uint32_t                           sent = 0;
+        while (sent < total) {
+            uint8_t count = std::min<uint32_t>(chunk(generator), total - sent);
+            for (uint8_t i = 0; i < count; i++) {
+                items[i] = (sent + i) * 7;
+            }
+            uint8_t written = spsc_queue_write(&queue, items, count);
+            sent += written;
+            if (written == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::mt19937                       generator(2);
+    std::uniform_int_distribution<int> chunk(1, size);
+    uint8_t                            items[256];
+    uint32_t                           received   = 0;
+    uint32_t                           mismatches = 0;
+    while (received < total) {
+        uint8_t count = spsc_queue_read(&queue, items, chunk(generator));
+        for (uint8_t i = 0; i < count; i++) {
+            mismatches += items[i] != (uint8_t)((received + i) * 7);
+        }
+        received += count;
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(mismatches, 0u) << "queue of size " << size;
+    EXPECT_EQ(received, total);
+    EXPECT_EQ(spsc_queue_length(&queue), 0);
+}
+
+TEST_F(SpscQueueTest, StressTwoThreads) {
+    stress(2, 100000);
+    stress(16, 1000000);
+    stress(256, 2000000);
+}
@@ -1,6 +1,7 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "ucis.h"
 #include "unicode.h"
 #include "action.h"
@@ -9,10 +10,74 @@ uint8_t count                        = 0;
 bool    active                       = false;
 char    input[UCIS_MAX_INPUT_LENGTH] = {0};
 
+// Number of entries in the symbol table, and whether their mnemonics are in ascending order
+static uint16_t symbol_count   = 0;
+static bool     symbols_sorted = false;
+static bool     symbols_known  = false;
+
+// For a sorted table, the entries [match_first, match_last) are those starting with the input so far
+static uint16_t match_first = 0;
+static uint16_t match_last  = 0;
+
+static void ucis_scan_symbol_table(void) {
+    if (symbols_known) {
+        return;
+    }
+    symbol_count   = 0;
+    symbols_sorted = true;
+    for (; ucis_symbol_table[symbol_count].mnemonic; symbol_count++) {
+        if (symbol_count > 0 && strcmp(ucis_symbol_table[symbol_count - 1].mnemonic, ucis_symbol_table[symbol_count].mnemonic) > 0) {
+            symbols_sorted = false;
+        }
+    }
+    symbols_known = true;
+    match_first   = 0;
+    match_last    = symbol_count;
+}
+
+// First entry in the match range whose character at `position` is not below `c` (or above it, for `upper`)
+static uint16_t ucis_bound(uint8_t position, uint8_t c, bool upper) {
+    uint16_t low  = match_first;
+    uint16_t high = match_last;
+    while (low < high) {
+        uint16_t mid   = low + (high - low) / 2;
+        uint8_t  other = (uint8_t)ucis_symbol_table[mid].mnemonic[position];
+        if (other < c || (upper && other == c)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Narrows the match range to the entries that also agree with the input at `position`
+static void ucis_narrow(uint8_t position) {
+    if (match_first < match_last) {
+        uint8_t  c   = (uint8_t)input[position];
+        uint16_t end = ucis_bound(position, c, true);
+        match_first = ucis_bound(position, c, false);
+        match_last  = end;
+    }
+}
+
+static void ucis_rematch(void) {
+    match_first = 0;
+    match_last  = symbol_count;
+    if (symbols_sorted) {
+        for (uint8_t i = 0; i < count; i++) {
+            ucis_narrow(i);
+        }
+    }
+}
+
 void ucis_start(void) {
     count  = 0;
     active = true;
 
+    ucis_scan_symbol_table();
+    ucis_rematch();
+
     register_unicode(0x2328); // ⌨
 }
 
@@ -38,7 +103,11 @@ static char keycode_to_char(uint16_t keycode) {
 bool ucis_add(uint16_t keycode) {
     char c = keycode_to_char(keycode);
     if (c) {
+        ucis_scan_symbol_table();
         input[count++] = c;
+        if (symbols_sorted) {
+            ucis_narrow(count - 1);
+        }
         return true;
     }
     return false;
@@ -47,28 +116,44 @@ bool ucis_add(uint16_t keycode) {
 bool ucis_remove_last(void) {
     if (count) {
         count--;
+        ucis_rematch();
         return true;
     }
 
     return false;
 }
 
-static bool match_mnemonic(char *mnemonic) {
-    for (uint8_t i = 0; input[i]; i++) {
-        if (i > count || input[i] != mnemonic[i]) {
-            return false;
+static bool match_mnemonic(const char *mnemonic) {
+    return strncmp(input, mnemonic, count) == 0 && mnemonic[count] == '\0';
+}
+
+bool ucis_prefix_matches(void) {
+    ucis_scan_symbol_table();
+    if (symbols_sorted) {
+        return match_first < match_last;
+    }
+    for (uint16_t i = 0; i < symbol_count; i++) {
+        if (strncmp(input, ucis_symbol_table[i].mnemonic, count) == 0) {
+            return true;
         }
     }
-    return true;
+    return false;
 }
 
 void ucis_finish(void) {
-    uint8_t i     = 0;
-    bool    found = false;
-    for (; ucis_symbol_table[i].mnemonic; i++) {
-        if (match_mnemonic(ucis_symbol_table[i].mnemonic)) {
-            found = true;
-            break;
+    uint16_t i     = 0;
+    bool     found = false;
+    ucis_scan_symbol_table();
+    if (count > 0 && symbols_sorted) {
+        // A complete mnemonic sorts before the longer ones it is a prefix of
+        i     = match_first;
+        found = match_first < match_last && ucis_symbol_table[i].mnemonic[count] == '\0';
+    } else if (count > 0) {
+        for (; i < symbol_count; i++) {
+            if (match_mnemonic(ucis_symbol_table[i].mnemonic)) {
+                found = true;
+                break;
+            }
         }
     }
 
@@ -87,7 +172,7 @@ void ucis_cancel(void) {
     active = false;
 }
 
-void register_ucis(uint8_t index) {
+void register_ucis(uint16_t index) {
     const uint32_t *code_points = ucis_symbol_table[index].code_points;
 
     for (int i = 0; i < UCIS_MAX_CODE_POINTS && code_points[i]; i++) {
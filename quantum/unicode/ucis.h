@@ -77,6 +77,15 @@ bool ucis_add(uint16_t keycode);
  */
 bool ucis_remove_last(void);
 
+/**
+ * \brief Whether any mnemonic in the symbol table starts with the input sequence.
+ *
+ * When the symbol table is sorted by mnemonic, this is kept up to date as characters are added or removed.
+ *
+ * \return `false` if the input sequence can no longer match.
+ */
+bool ucis_prefix_matches(void);
+
 /**
  * Mark the input sequence as complete, and attempt to match.
  */
@@ -92,6 +101,6 @@ void ucis_cancel(void);
  *
  * \param index The index into the UCIS symbol table.
  */
-void register_ucis(uint8_t index);
+void register_ucis(uint16_t index);
 
 /** \} */
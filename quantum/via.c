@@ -37,6 +37,10 @@
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
 
+#ifdef MATRIX_TELEMETRY_ENABLE
+#    include "matrix_telemetry.h"
+#endif
+
 #if defined(SECURE_ENABLE)
 #    include "secure.h"
 #endif
@@ -469,6 +473,11 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         }
 #endif
         default: {
+#ifdef MATRIX_TELEMETRY_ENABLE
+            if (matrix_telemetry_raw_hid_receive(data, length)) {
+                break;
+            }
+#endif
             // The command ID is not known
             // Return the unhandled state
             *command_id = id_unhandled;
@@ -0,0 +1,577 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated with `qmk generate-autocorrect-data --bitmap-index` from a dictionary of 512 random
+// typos, listed in test_autocorrect_bitmap.cpp.
+
+#pragma once
+
+#define AUTOCORRECT_MIN_LENGTH 7 // "hdytnat"
+#define AUTOCORRECT_MAX_LENGTH 11 // "frbterdsdo:"
+#define DICTIONARY_SIZE 9005
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x40, 0xFF, 0xFF, 0xFF, 0x0B, 0x1E, 0x02, 0x2E, 0x04, 0xB5, 0x04, 0xBE, 0x05, 0xB8, 0x07, 0xF5,
+    0x09, 0xF0, 0x0A, 0xE5, 0x0B, 0xEC, 0x0D, 0xBD, 0x0F, 0x6A, 0x10, 0xE5, 0x10, 0x39, 0x12, 0x2D,
+    0x13, 0xF7, 0x15, 0x3C, 0x18, 0xC6, 0x18, 0x17, 0x19, 0x4A, 0x1B, 0x30, 0x1D, 0x26, 0x1F, 0x47,
+    0x20, 0xCA, 0x20, 0xD2, 0x21, 0x34, 0x22, 0xFA, 0x22, 0x3B, 0x00, 0x40, 0xE9, 0x5B, 0xD6, 0x00,
+    0x5E, 0x00, 0x83, 0x00, 0x97, 0x00, 0xB9, 0x00, 0xDC, 0x00, 0xEB, 0x00, 0x20, 0x01, 0x30, 0x01,
+    0x57, 0x01, 0x67, 0x01, 0x90, 0x01, 0xCC, 0x01, 0xF5, 0x01, 0x02, 0x02, 0x13, 0x02, 0x47, 0x65,
+    0x00, 0x1B, 0x77, 0x00, 0x00, 0x0B, 0x1D, 0x15, 0x04, 0x17, 0x08, 0x0B, 0x11, 0x00, 0x87, 0x61,
+    0x74, 0x72, 0x7A, 0x68, 0x64, 0x61, 0x00, 0x08, 0x14, 0x0C, 0x0E, 0x0E, 0x08, 0x0C, 0x00, 0x82,
+    0x61, 0x78, 0x00, 0x15, 0x12, 0x0F, 0x0C, 0x17, 0x04, 0x11, 0x16, 0x04, 0x00, 0x88, 0x61, 0x6E,
+    0x74, 0x69, 0x6C, 0x6F, 0x72, 0x64, 0x00, 0x4B, 0x9E, 0x00, 0x17, 0xAA, 0x00, 0x00, 0x15, 0x15,
+    0x0B, 0x08, 0x17, 0x07, 0x00, 0x83, 0x68, 0x72, 0x66, 0x00, 0x1C, 0x04, 0x15, 0x0F, 0x0A, 0x11,
+    0x0B, 0x0B, 0x00, 0x84, 0x79, 0x61, 0x74, 0x66, 0x00, 0x48, 0xC0, 0x00, 0x12, 0xCD, 0x00, 0x00,
+    0x12, 0x06, 0x17, 0x1C, 0x1D, 0x00, 0x85, 0x63, 0x74, 0x6F, 0x65, 0x67, 0x00, 0x0C, 0x06, 0x16,
+    0x0C, 0x17, 0x12, 0x00, 0x86, 0x73, 0x69, 0x63, 0x69, 0x6F, 0x67, 0x00, 0x12, 0x05, 0x08, 0x12,
+    0x04, 0x12, 0x00, 0x86, 0x6F, 0x61, 0x65, 0x62, 0x6F, 0x68, 0x00, 0x55, 0xF2, 0x00, 0x17, 0x13,
+    0x01, 0x00, 0x1C, 0x00, 0x44, 0xFB, 0x00, 0x0F, 0x07, 0x01, 0x00, 0x18, 0x09, 0x07, 0x12, 0x04,
+    0x0A, 0x00, 0x83, 0x72, 0x79, 0x69, 0x00, 0x05, 0x0F, 0x0A, 0x08, 0x10, 0x12, 0x00, 0x83, 0x72,
+    0x79, 0x69, 0x00, 0x17, 0x09, 0x14, 0x12, 0x06, 0x0D, 0x16, 0x0C, 0x00, 0x82, 0x69, 0x74, 0x00,
+    0x08, 0x07, 0x15, 0x12, 0x07, 0x17, 0x04, 0x07, 0x00, 0x85, 0x72, 0x6F, 0x64, 0x65, 0x6A, 0x00,
+    0x55, 0x37, 0x01, 0x1B, 0x47, 0x01, 0x00, 0x06, 0x10, 0x0C, 0x15, 0x0C, 0x08, 0x00, 0x87, 0x72,
+    0x69, 0x69, 0x6D, 0x63, 0x72, 0x6C, 0x00, 0x11, 0x1C, 0x0A, 0x11, 0x1B, 0x0D, 0x16, 0x08, 0x00,
+    0x85, 0x79, 0x67, 0x6E, 0x78, 0x6C, 0x00, 0x16, 0x1D, 0x0A, 0x05, 0x07, 0x05, 0x06, 0x00, 0x86,
+    0x62, 0x64, 0x67, 0x7A, 0x73, 0x6D, 0x00, 0x47, 0x6E, 0x01, 0x08, 0x81, 0x01, 0x00, 0x16, 0x07,
+    0x15, 0x08, 0x17, 0x05, 0x15, 0x09, 0x00, 0x88, 0x74, 0x62, 0x65, 0x72, 0x64, 0x73, 0x64, 0x6F,
+    0x00, 0x11, 0x07, 0x09, 0x0B, 0x0F, 0x08, 0x11, 0x07, 0x00, 0x84, 0x6E, 0x64, 0x65, 0x6F, 0x00,
+    0x40, 0x01, 0x80, 0x0C, 0x00, 0x9D, 0x01, 0xAA, 0x01, 0xB5, 0x01, 0xC1, 0x01, 0x04, 0x16, 0x17,
+    0x07, 0x07, 0x00, 0x85, 0x73, 0x74, 0x61, 0x61, 0x72, 0x00, 0x11, 0x06, 0x07, 0x1C, 0x10, 0x12,
+    0x00, 0x82, 0x72, 0x70, 0x00, 0x18, 0x15, 0x08, 0x07, 0x17, 0x00, 0x84, 0x75, 0x72, 0x73, 0x72,
+    0x00, 0x1A, 0x0B, 0x08, 0x12, 0x12, 0x00, 0x83, 0x74, 0x77, 0x72, 0x00, 0x44, 0xD3, 0x01, 0x12,
+    0xE1, 0x01, 0x00, 0x12, 0x09, 0x04, 0x10, 0x12, 0x00, 0x86, 0x61, 0x6D, 0x66, 0x6F, 0x61, 0x73,
+    0x00, 0x17, 0x04, 0x0B, 0x06, 0x18, 0x0F, 0x09, 0x08, 0x00, 0x89, 0x6C, 0x66, 0x75, 0x63, 0x68,
+    0x61, 0x74, 0x6F, 0x73, 0x00, 0x1A, 0x0F, 0x15, 0x19, 0x10, 0x11, 0x09, 0x00, 0x83, 0x77, 0x6C,
+    0x75, 0x00, 0x1D, 0x04, 0x1C, 0x11, 0x19, 0x04, 0x16, 0x00, 0x87, 0x76, 0x61, 0x6E, 0x79, 0x61,
+    0x7A, 0x77, 0x00, 0x18, 0x07, 0x05, 0x12, 0x08, 0x12, 0x00, 0x82, 0x78, 0x75, 0x00, 0x40, 0x97,
+    0x69, 0x5E, 0x03, 0x43, 0x02, 0x56, 0x02, 0x69, 0x02, 0x87, 0x02, 0xAF, 0x02, 0xBD, 0x02, 0xD9,
+    0x02, 0xFA, 0x02, 0x40, 0x03, 0x73, 0x03, 0x7F, 0x03, 0xC0, 0x03, 0xE4, 0x03, 0x08, 0x04, 0x15,
+    0x04, 0x20, 0x04, 0x0D, 0x0A, 0x09, 0x17, 0x1D, 0x11, 0x15, 0x2C, 0x00, 0x87, 0x7A, 0x6E, 0x74,
+    0x66, 0x67, 0x6A, 0x61, 0x61, 0x00, 0x12, 0x17, 0x15, 0x12, 0x1A, 0x11, 0x04, 0x08, 0x00, 0x87,
+    0x77, 0x6E, 0x6F, 0x72, 0x74, 0x6F, 0x62, 0x61, 0x00, 0x55, 0x70, 0x02, 0x1A, 0x7A, 0x02, 0x00,
+    0x16, 0x06, 0x18, 0x0B, 0x00, 0x82, 0x63, 0x72, 0x61, 0x00, 0x16, 0x0F, 0x1C, 0x15, 0x1C, 0x07,
+    0x00, 0x83, 0x77, 0x73, 0x63, 0x61, 0x00, 0x46, 0x8E, 0x02, 0x17, 0x9E, 0x02, 0x00, 0x08, 0x16,
+    0x0A, 0x06, 0x11, 0x04, 0x00, 0x86, 0x67, 0x63, 0x73, 0x65, 0x63, 0x65, 0x61, 0x00, 0x18, 0x11,
+    0x07, 0x0C, 0x15, 0x0E, 0x13, 0x00, 0x86, 0x64, 0x69, 0x6E, 0x75, 0x74, 0x65, 0x61, 0x00, 0x0D,
+    0x04, 0x09, 0x13, 0x16, 0x07, 0x00, 0x84, 0x61, 0x66, 0x6A, 0x68, 0x61, 0x00, 0x56, 0xC4, 0x02,
+    0x1A, 0xCF, 0x02, 0x00, 0x07, 0x1C, 0x18, 0x1A, 0x16, 0x00, 0x82, 0x69, 0x73, 0x61, 0x00, 0x0C,
+    0x11, 0x12, 0x07, 0x00, 0x82, 0x69, 0x77, 0x61, 0x00, 0x44, 0xE0, 0x02, 0x0B, 0xEF, 0x02, 0x00,
+    0x11, 0x16, 0x08, 0x1C, 0x16, 0x09, 0x00, 0x85, 0x73, 0x65, 0x6E, 0x61, 0x6C, 0x61, 0x00, 0x1C,
+    0x04, 0x1C, 0x0B, 0x00, 0x83, 0x68, 0x79, 0x6C, 0x61, 0x00, 0x40, 0x01, 0x30, 0x40, 0x00, 0x07,
+    0x03, 0x17, 0x03, 0x25, 0x03, 0x30, 0x03, 0x08, 0x18, 0x0A, 0x16, 0x06, 0x0B, 0x0C, 0x00, 0x85,
+    0x75, 0x67, 0x65, 0x61, 0x6E, 0x61, 0x00, 0x15, 0x08, 0x0D, 0x12, 0x16, 0x00, 0x85, 0x65, 0x6A,
+    0x72, 0x6D, 0x6E, 0x61, 0x00, 0x17, 0x04, 0x08, 0x08, 0x17, 0x11, 0x00, 0x81, 0x61, 0x6E, 0x00,
+    0x07, 0x1A, 0x16, 0x04, 0x0B, 0x1A, 0x00, 0x86, 0x73, 0x61, 0x77, 0x64, 0x77, 0x6E, 0x61, 0x00,
+    0x4C, 0x4A, 0x03, 0x12, 0x57, 0x03, 0x15, 0x66, 0x03, 0x00, 0x18, 0x11, 0x11, 0x0C, 0x1C, 0x14,
+    0x08, 0x00, 0x82, 0x6F, 0x69, 0x61, 0x00, 0x16, 0x08, 0x11, 0x12, 0x17, 0x17, 0x00, 0x85, 0x65,
+    0x6E, 0x73, 0x6F, 0x6F, 0x61, 0x00, 0x12, 0x12, 0x05, 0x0C, 0x10, 0x04, 0x00, 0x83, 0x72, 0x6F,
+    0x6F, 0x61, 0x00, 0x06, 0x19, 0x0C, 0x11, 0x15, 0x04, 0x08, 0x00, 0x81, 0x61, 0x72, 0x00, 0x49,
+    0x89, 0x03, 0x0A, 0x98, 0x03, 0x1C, 0xA2, 0x03, 0x00, 0x07, 0x07, 0x0E, 0x11, 0x1B, 0x08, 0x00,
+    0x85, 0x64, 0x6B, 0x64, 0x66, 0x73, 0x61, 0x00, 0x19, 0x11, 0x0D, 0x0A, 0x08, 0x00, 0x81, 0x61,
+    0x73, 0x00, 0x44, 0xA9, 0x03, 0x18, 0xB5, 0x03, 0x00, 0x18, 0x07, 0x12, 0x0C, 0x00, 0x84, 0x61,
+    0x75, 0x79, 0x73, 0x61, 0x00, 0x1C, 0x17, 0x12, 0x09, 0x12, 0x11, 0x00, 0x81, 0x61, 0x73, 0x00,
+    0x55, 0xC7, 0x03, 0x16, 0xD5, 0x03, 0x00, 0x09, 0x1B, 0x12, 0x0A, 0x0F, 0x0C, 0x15, 0x00, 0x83,
+    0x72, 0x66, 0x74, 0x61, 0x00, 0x07, 0x18, 0x05, 0x0C, 0x11, 0x11, 0x00, 0x85, 0x75, 0x62, 0x64,
+    0x73, 0x74, 0x61, 0x00, 0x47, 0xEB, 0x03, 0x1C, 0xFA, 0x03, 0x00, 0x16, 0x08, 0x14, 0x07, 0x17,
+    0x00, 0x86, 0x71, 0x64, 0x65, 0x73, 0x64, 0x75, 0x61, 0x00, 0x0B, 0x05, 0x11, 0x0F, 0x13, 0x0E,
+    0x10, 0x00, 0x83, 0x79, 0x68, 0x75, 0x61, 0x00, 0x0A, 0x04, 0x11, 0x12, 0x04, 0x00, 0x84, 0x61,
+    0x6E, 0x67, 0x77, 0x61, 0x00, 0x08, 0x08, 0x1A, 0x13, 0x1C, 0x00, 0x82, 0x79, 0x65, 0x61, 0x00,
+    0x06, 0x11, 0x12, 0x0C, 0x1B, 0x12, 0x00, 0x84, 0x6E, 0x6F, 0x63, 0x7A, 0x61, 0x00, 0x40, 0x30,
+    0x09, 0x0B, 0x00, 0x41, 0x04, 0x50, 0x04, 0x5A, 0x04, 0x7A, 0x04, 0x87, 0x04, 0x9A, 0x04, 0xA8,
+    0x04, 0x06, 0x09, 0x08, 0x1A, 0x07, 0x06, 0x04, 0x00, 0x84, 0x66, 0x65, 0x63, 0x65, 0x62, 0x00,
+    0x07, 0x0C, 0x08, 0x11, 0x09, 0x00, 0x81, 0x62, 0x66, 0x00, 0x11, 0x00, 0x58, 0x63, 0x04, 0x1B,
+    0x71, 0x04, 0x00, 0x0A, 0x18, 0x12, 0x11, 0x00, 0x86, 0x75, 0x6F, 0x67, 0x75, 0x6E, 0x69, 0x62,
+    0x00, 0x0F, 0x07, 0x11, 0x00, 0x82, 0x69, 0x6E, 0x62, 0x00, 0x17, 0x16, 0x11, 0x1B, 0x07, 0x00,
+    0x84, 0x73, 0x6E, 0x74, 0x6C, 0x62, 0x00, 0x0F, 0x13, 0x18, 0x09, 0x0B, 0x34, 0x04, 0x07, 0x12,
+    0x00, 0x87, 0x68, 0x66, 0x70, 0x75, 0x6C, 0x71, 0x62, 0x00, 0x1A, 0x08, 0x0A, 0x13, 0x07, 0x00,
+    0x85, 0x67, 0x70, 0x65, 0x77, 0x72, 0x62, 0x00, 0x0F, 0x15, 0x13, 0x0C, 0x15, 0x00, 0x84, 0x72,
+    0x70, 0x6C, 0x74, 0x62, 0x00, 0x40, 0xD8, 0x38, 0x14, 0x00, 0xCC, 0x04, 0xFC, 0x04, 0x0C, 0x05,
+    0x19, 0x05, 0x39, 0x05, 0x5F, 0x05, 0x71, 0x05, 0x9D, 0x05, 0xAF, 0x05, 0x48, 0xD6, 0x04, 0x14,
+    0xE6, 0x04, 0x16, 0xF2, 0x04, 0x00, 0x11, 0x1C, 0x12, 0x0C, 0x18, 0x17, 0x04, 0x00, 0x85, 0x79,
+    0x6F, 0x6E, 0x65, 0x64, 0x63, 0x00, 0x17, 0x1B, 0x0A, 0x04, 0x00, 0x84, 0x74, 0x78, 0x71, 0x64,
+    0x63, 0x00, 0x0A, 0x10, 0x17, 0x1A, 0x00, 0x82, 0x64, 0x73, 0x63, 0x00, 0x11, 0x10, 0x16, 0x12,
+    0x11, 0x18, 0x11, 0x2C, 0x00, 0x84, 0x6D, 0x73, 0x6E, 0x65, 0x63, 0x00, 0x1B, 0x11, 0x04, 0x15,
+    0x04, 0x0F, 0x00, 0x83, 0x78, 0x6E, 0x67, 0x63, 0x00, 0x48, 0x20, 0x05, 0x15, 0x2C, 0x05, 0x00,
+    0x06, 0x08, 0x04, 0x1D, 0x12, 0x00, 0x83, 0x65, 0x63, 0x68, 0x63, 0x00, 0x12, 0x07, 0x16, 0x17,
+    0x11, 0x16, 0x1C, 0x00, 0x82, 0x68, 0x72, 0x63, 0x00, 0x51, 0x40, 0x05, 0x15, 0x52, 0x05, 0x00,
+    0x04, 0x11, 0x11, 0x0B, 0x0F, 0x05, 0x15, 0x00, 0x87, 0x68, 0x6C, 0x6E, 0x6E, 0x61, 0x6E, 0x6C,
+    0x63, 0x00, 0x0B, 0x17, 0x12, 0x0F, 0x15, 0x15, 0x00, 0x83, 0x72, 0x68, 0x6C, 0x63, 0x00, 0x07,
+    0x0B, 0x09, 0x1A, 0x1D, 0x17, 0x07, 0x07, 0x00, 0x86, 0x77, 0x7A, 0x66, 0x68, 0x64, 0x6D, 0x63,
+    0x00, 0x51, 0x7B, 0x05, 0x16, 0x88, 0x05, 0x17, 0x91, 0x05, 0x00, 0x0C, 0x12, 0x0A, 0x18, 0x12,
+    0x10, 0x00, 0x83, 0x6E, 0x69, 0x6E, 0x63, 0x00, 0x11, 0x16, 0x14, 0x17, 0x00, 0x81, 0x63, 0x6E,
+    0x00, 0x10, 0x04, 0x12, 0x0C, 0x07, 0x00, 0x83, 0x74, 0x6D, 0x6E, 0x63, 0x00, 0x12, 0x1A, 0x12,
+    0x15, 0x04, 0x17, 0x1D, 0x16, 0x00, 0x86, 0x72, 0x61, 0x6F, 0x77, 0x6F, 0x73, 0x63, 0x00, 0x17,
+    0x06, 0x1A, 0x16, 0x04, 0x10, 0x00, 0x85, 0x77, 0x73, 0x63, 0x74, 0x75, 0x63, 0x00, 0x40, 0xB9,
+    0x75, 0x4F, 0x00, 0xE1, 0x05, 0x02, 0x06, 0x11, 0x06, 0x4D, 0x06, 0x5C, 0x06, 0x6A, 0x06, 0x98,
+    0x06, 0xA4, 0x06, 0xC6, 0x06, 0xFC, 0x06, 0x0C, 0x07, 0x1B, 0x07, 0x58, 0x07, 0x66, 0x07, 0xAB,
+    0x07, 0x4D, 0xE8, 0x05, 0x1B, 0xF5, 0x05, 0x00, 0x16, 0x34, 0x12, 0x16, 0x17, 0x00, 0x85, 0x73,
+    0x6F, 0x6A, 0x61, 0x64, 0x00, 0x19, 0x15, 0x17, 0x1C, 0x00, 0x85, 0x72, 0x74, 0x76, 0x78, 0x61,
+    0x64, 0x00, 0x12, 0x0A, 0x1C, 0x11, 0x05, 0x2C, 0x00, 0x85, 0x79, 0x6E, 0x67, 0x6F, 0x64, 0x64,
+    0x00, 0x44, 0x1B, 0x06, 0x06, 0x2E, 0x06, 0x0C, 0x3C, 0x06, 0x00, 0x18, 0x17, 0x1C, 0x0C, 0x18,
+    0x0F, 0x07, 0x00, 0x88, 0x75, 0x6C, 0x69, 0x79, 0x74, 0x75, 0x61, 0x65, 0x64, 0x00, 0x17, 0x11,
+    0x04, 0x12, 0x15, 0x00, 0x85, 0x6E, 0x61, 0x74, 0x63, 0x65, 0x64, 0x00, 0x09, 0x0B, 0x17, 0x1B,
+    0x07, 0x12, 0x10, 0x00, 0x86, 0x74, 0x78, 0x68, 0x66, 0x69, 0x65, 0x64, 0x00, 0x12, 0x12, 0x10,
+    0x17, 0x13, 0x0B, 0x16, 0x00, 0x84, 0x6F, 0x6D, 0x6F, 0x66, 0x64, 0x00, 0x0B, 0x07, 0x0F, 0x0B,
+    0x04, 0x08, 0x0B, 0x00, 0x83, 0x68, 0x64, 0x68, 0x64, 0x00, 0x47, 0x74, 0x06, 0x0E, 0x7D, 0x06,
+    0x15, 0x8B, 0x06, 0x00, 0x1A, 0x1D, 0x06, 0x06, 0x00, 0x81, 0x64, 0x69, 0x00, 0x0B, 0x0F, 0x15,
+    0x12, 0x12, 0x00, 0x85, 0x6C, 0x72, 0x68, 0x6B, 0x69, 0x64, 0x00, 0x05, 0x04, 0x18, 0x15, 0x0B,
+    0x0D, 0x10, 0x00, 0x82, 0x69, 0x72, 0x64, 0x00, 0x04, 0x15, 0x04, 0x14, 0x06, 0x15, 0x00, 0x82,
+    0x6B, 0x61, 0x64, 0x00, 0x49, 0xAB, 0x06, 0x15, 0xBA, 0x06, 0x00, 0x18, 0x0B, 0x0B, 0x0B, 0x13,
+    0x15, 0x12, 0x00, 0x84, 0x75, 0x68, 0x66, 0x6D, 0x64, 0x00, 0x17, 0x1C, 0x0B, 0x0B, 0x00, 0x84,
+    0x74, 0x79, 0x72, 0x6D, 0x64, 0x00, 0x47, 0xD0, 0x06, 0x09, 0xDF, 0x06, 0x11, 0xED, 0x06, 0x00,
+    0x0A, 0x1C, 0x17, 0x14, 0x0B, 0x11, 0x07, 0x00, 0x84, 0x67, 0x79, 0x64, 0x6E, 0x64, 0x00, 0x12,
+    0x0B, 0x06, 0x07, 0x04, 0x00, 0x85, 0x68, 0x63, 0x6F, 0x66, 0x6E, 0x64, 0x00, 0x0B, 0x06, 0x0F,
+    0x11, 0x12, 0x00, 0x86, 0x6C, 0x6E, 0x63, 0x68, 0x6E, 0x6E, 0x64, 0x00, 0x07, 0x13, 0x10, 0x10,
+    0x0A, 0x08, 0x00, 0x86, 0x6D, 0x67, 0x6D, 0x70, 0x64, 0x6F, 0x64, 0x00, 0x18, 0x07, 0x08, 0x12,
+    0x04, 0x1B, 0x00, 0x85, 0x65, 0x6F, 0x64, 0x75, 0x71, 0x64, 0x00, 0x40, 0x88, 0x40, 0x08, 0x00,
+    0x28, 0x07, 0x35, 0x07, 0x3F, 0x07, 0x49, 0x07, 0x08, 0x06, 0x11, 0x0B, 0x07, 0x1A, 0x07, 0x2C,
+    0x00, 0x81, 0x64, 0x72, 0x00, 0x1B, 0x1B, 0x08, 0x09, 0x00, 0x82, 0x72, 0x68, 0x64, 0x00, 0x13,
+    0x04, 0x09, 0x1C, 0x1C, 0x00, 0x81, 0x64, 0x72, 0x00, 0x07, 0x06, 0x08, 0x17, 0x07, 0x2C, 0x00,
+    0x85, 0x63, 0x65, 0x64, 0x74, 0x72, 0x64, 0x00, 0x1A, 0x11, 0x0A, 0x04, 0x17, 0x1C, 0x17, 0x04,
+    0x00, 0x82, 0x73, 0x77, 0x64, 0x00, 0x40, 0x01, 0x80, 0x06, 0x00, 0x73, 0x07, 0x7F, 0x07, 0x8F,
+    0x07, 0x9D, 0x07, 0x0C, 0x12, 0x14, 0x04, 0x0D, 0x16, 0x00, 0x82, 0x74, 0x61, 0x64, 0x00, 0x11,
+    0x17, 0x09, 0x08, 0x0B, 0x11, 0x00, 0x86, 0x66, 0x65, 0x74, 0x6E, 0x70, 0x74, 0x64, 0x00, 0x18,
+    0x16, 0x1A, 0x15, 0x2C, 0x00, 0x85, 0x73, 0x77, 0x75, 0x72, 0x74, 0x64, 0x00, 0x1A, 0x34, 0x07,
+    0x0A, 0x09, 0x00, 0x86, 0x64, 0x67, 0x77, 0x73, 0x74, 0x64, 0x00, 0x1D, 0x0B, 0x07, 0x08, 0x19,
+    0x00, 0x84, 0x68, 0x64, 0x7A, 0x77, 0x64, 0x00, 0x40, 0xD9, 0x79, 0x1E, 0x01, 0xDB, 0x07, 0x10,
+    0x08, 0x2E, 0x08, 0x63, 0x08, 0x75, 0x08, 0x95, 0x08, 0xB5, 0x08, 0xC6, 0x08, 0xD1, 0x08, 0x0A,
+    0x09, 0x1C, 0x09, 0x6B, 0x09, 0x8D, 0x09, 0xD8, 0x09, 0xE7, 0x09, 0x4B, 0xE5, 0x07, 0x0F, 0xF2,
+    0x07, 0x16, 0xFF, 0x07, 0x00, 0x17, 0x0F, 0x12, 0x11, 0x08, 0x15, 0x00, 0x83, 0x68, 0x74, 0x61,
+    0x65, 0x00, 0x04, 0x16, 0x09, 0x17, 0x07, 0x15, 0x00, 0x83, 0x6C, 0x61, 0x61, 0x65, 0x00, 0x15,
+    0x15, 0x04, 0x08, 0x04, 0x17, 0x00, 0x87, 0x65, 0x61, 0x61, 0x72, 0x72, 0x73, 0x61, 0x65, 0x00,
+    0x46, 0x17, 0x08, 0x12, 0x23, 0x08, 0x00, 0x18, 0x12, 0x10, 0x0A, 0x07, 0x17, 0x00, 0x82, 0x64,
+    0x63, 0x65, 0x00, 0x04, 0x10, 0x18, 0x08, 0x11, 0x1B, 0x00, 0x81, 0x65, 0x64, 0x00, 0x44, 0x38,
+    0x08, 0x08, 0x46, 0x08, 0x1B, 0x57, 0x08, 0x00, 0x08, 0x0A, 0x14, 0x08, 0x11, 0x06, 0x00, 0x84,
+    0x65, 0x67, 0x61, 0x65, 0x65, 0x00, 0x11, 0x15, 0x19, 0x1D, 0x15, 0x18, 0x00, 0x87, 0x7A, 0x72,
+    0x76, 0x72, 0x6E, 0x65, 0x65, 0x65, 0x00, 0x15, 0x05, 0x0B, 0x11, 0x00, 0x84, 0x72, 0x62, 0x78,
+    0x65, 0x65, 0x00, 0x07, 0x04, 0x18, 0x09, 0x04, 0x16, 0x06, 0x08, 0x00, 0x86, 0x66, 0x61, 0x75,
+    0x61, 0x64, 0x67, 0x65, 0x00, 0x0C, 0x00, 0x47, 0x7E, 0x08, 0x0A, 0x89, 0x08, 0x00, 0x1C, 0x10,
+    0x08, 0x0E, 0x2C, 0x00, 0x82, 0x68, 0x69, 0x65, 0x00, 0x14, 0x0F, 0x0B, 0x0A, 0x15, 0x00, 0x83,
+    0x69, 0x67, 0x68, 0x65, 0x00, 0x48, 0x9C, 0x08, 0x0C, 0xA9, 0x08, 0x00, 0x15, 0x18, 0x10, 0x07,
+    0x00, 0x85, 0x75, 0x6D, 0x72, 0x65, 0x69, 0x65, 0x00, 0x12, 0x0F, 0x04, 0x1A, 0x18, 0x04, 0x0B,
+    0x00, 0x81, 0x65, 0x69, 0x00, 0x14, 0x0B, 0x0F, 0x11, 0x09, 0x17, 0x04, 0x00, 0x86, 0x6E, 0x66,
+    0x6C, 0x68, 0x71, 0x6C, 0x65, 0x00, 0x04, 0x0A, 0x0C, 0x16, 0x0C, 0x00, 0x82, 0x6D, 0x61, 0x65,
+    0x00, 0x4A, 0xDB, 0x08, 0x0B, 0xE7, 0x08, 0x0C, 0xF8, 0x08, 0x00, 0x09, 0x14, 0x14, 0x04, 0x00,
+    0x84, 0x66, 0x71, 0x67, 0x6E, 0x65, 0x00, 0x0C, 0x0B, 0x0B, 0x0F, 0x18, 0x0F, 0x12, 0x00, 0x86,
+    0x68, 0x6C, 0x68, 0x69, 0x68, 0x6E, 0x65, 0x00, 0x15, 0x17, 0x04, 0x13, 0x17, 0x18, 0x08, 0x00,
+    0x87, 0x70, 0x74, 0x61, 0x74, 0x72, 0x69, 0x6E, 0x65, 0x00, 0x10, 0x16, 0x12, 0x16, 0x0C, 0x07,
+    0x07, 0x00, 0x87, 0x69, 0x64, 0x73, 0x6F, 0x73, 0x6D, 0x6F, 0x65, 0x00, 0x40, 0x40, 0x20, 0x54,
+    0x00, 0x2B, 0x09, 0x38, 0x09, 0x44, 0x09, 0x51, 0x09, 0x60, 0x09, 0x12, 0x1A, 0x15, 0x10, 0x00,
+    0x85, 0x77, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x00, 0x14, 0x1C, 0x16, 0x0B, 0x00, 0x84, 0x71, 0x79,
+    0x6E, 0x72, 0x65, 0x00, 0x0B, 0x16, 0x0E, 0x1A, 0x00, 0x85, 0x73, 0x6B, 0x68, 0x73, 0x72, 0x65,
+    0x00, 0x04, 0x08, 0x09, 0x11, 0x0F, 0x00, 0x86, 0x66, 0x6E, 0x65, 0x61, 0x75, 0x72, 0x65, 0x00,
+    0x15, 0x04, 0x1D, 0x0A, 0x15, 0x04, 0x00, 0x81, 0x65, 0x72, 0x00, 0x4A, 0x72, 0x09, 0x16, 0x7E,
+    0x09, 0x00, 0x0B, 0x08, 0x18, 0x0C, 0x07, 0x0E, 0x00, 0x82, 0x73, 0x67, 0x65, 0x00, 0x0F, 0x12,
+    0x0A, 0x08, 0x04, 0x00, 0x86, 0x67, 0x65, 0x6F, 0x6C, 0x73, 0x73, 0x65, 0x00, 0x4A, 0x97, 0x09,
+    0x11, 0xA6, 0x09, 0x1B, 0xC9, 0x09, 0x00, 0x0C, 0x06, 0x19, 0x0C, 0x11, 0x2C, 0x00, 0x85, 0x63,
+    0x76, 0x69, 0x67, 0x74, 0x65, 0x00, 0x44, 0xAD, 0x09, 0x07, 0xBC, 0x09, 0x00, 0x0C, 0x12, 0x0A,
+    0x09, 0x1C, 0x18, 0x00, 0x85, 0x69, 0x6F, 0x61, 0x6E, 0x74, 0x65, 0x00, 0x15, 0x07, 0x0D, 0x16,
+    0x06, 0x12, 0x00, 0x83, 0x6E, 0x64, 0x74, 0x65, 0x00, 0x1C, 0x13, 0x11, 0x08, 0x17, 0x00, 0x86,
+    0x6E, 0x65, 0x70, 0x79, 0x78, 0x74, 0x65, 0x00, 0x15, 0x0B, 0x15, 0x0F, 0x13, 0x16, 0x00, 0x85,
+    0x72, 0x6C, 0x68, 0x72, 0x75, 0x65, 0x00, 0x13, 0x0B, 0x07, 0x16, 0x15, 0x11, 0x0B, 0x06, 0x00,
+    0x82, 0x79, 0x70, 0x65, 0x00, 0x40, 0xB9, 0x21, 0x0E, 0x00, 0x0E, 0x0A, 0x31, 0x0A, 0x3B, 0x0A,
+    0x4A, 0x0A, 0x5A, 0x0A, 0x7B, 0x0A, 0x9F, 0x0A, 0xBF, 0x0A, 0xD0, 0x0A, 0xE2, 0x0A, 0x55, 0x15,
+    0x0A, 0x16, 0x25, 0x0A, 0x00, 0x14, 0x12, 0x08, 0x0C, 0x17, 0x15, 0x00, 0x86, 0x65, 0x69, 0x6F,
+    0x71, 0x72, 0x61, 0x66, 0x00, 0x12, 0x0C, 0x10, 0x1C, 0x16, 0x00, 0x83, 0x73, 0x6F, 0x61, 0x66,
+    0x00, 0x12, 0x18, 0x0B, 0x0C, 0x16, 0x00, 0x81, 0x66, 0x64, 0x00, 0x1A, 0x12, 0x11, 0x04, 0x17,
+    0x08, 0x16, 0x00, 0x84, 0x6F, 0x6E, 0x77, 0x65, 0x66, 0x00, 0x0C, 0x07, 0x04, 0x0B, 0x17, 0x18,
+    0x1C, 0x17, 0x00, 0x84, 0x64, 0x61, 0x69, 0x66, 0x66, 0x00, 0x49, 0x61, 0x0A, 0x19, 0x6E, 0x0A,
+    0x00, 0x09, 0x0B, 0x0C, 0x1C, 0x00, 0x85, 0x68, 0x69, 0x66, 0x66, 0x68, 0x66, 0x00, 0x08, 0x04,
+    0x05, 0x1C, 0x00, 0x85, 0x61, 0x62, 0x65, 0x76, 0x68, 0x66, 0x00, 0x49, 0x82, 0x0A, 0x12, 0x93,
+    0x0A, 0x00, 0x06, 0x09, 0x09, 0x12, 0x08, 0x09, 0x18, 0x00, 0x86, 0x66, 0x6F, 0x66, 0x63, 0x66,
+    0x69, 0x66, 0x00, 0x15, 0x08, 0x19, 0x19, 0x15, 0x17, 0x00, 0x82, 0x69, 0x6F, 0x66, 0x00, 0x44,
+    0xA6, 0x0A, 0x12, 0xB3, 0x0A, 0x00, 0x18, 0x07, 0x11, 0x0C, 0x11, 0x16, 0x15, 0x00, 0x82, 0x6E,
+    0x61, 0x66, 0x00, 0x1A, 0x34, 0x0E, 0x0C, 0x18, 0x00, 0x84, 0x77, 0x6E, 0x6F, 0x66, 0x00, 0x04,
+    0x08, 0x1A, 0x16, 0x15, 0x15, 0x07, 0x07, 0x00, 0x85, 0x77, 0x73, 0x65, 0x61, 0x72, 0x66, 0x00,
+    0x1A, 0x12, 0x1B, 0x13, 0x0C, 0x08, 0x11, 0x0C, 0x00, 0x86, 0x70, 0x69, 0x78, 0x6F, 0x77, 0x73,
+    0x66, 0x00, 0x0C, 0x04, 0x04, 0x1B, 0x19, 0x00, 0x85, 0x61, 0x78, 0x61, 0x69, 0x74, 0x66, 0x00,
+    0x40, 0x03, 0xE2, 0x06, 0x00, 0x05, 0x0B, 0x13, 0x0B, 0x1F, 0x0B, 0x2D, 0x0B, 0x70, 0x0B, 0x7D,
+    0x0B, 0x8A, 0x0B, 0xAE, 0x0B, 0x16, 0x17, 0x0B, 0x1C, 0x10, 0x00, 0x85, 0x68, 0x79, 0x74, 0x73,
+    0x61, 0x67, 0x00, 0x15, 0x0C, 0x16, 0x15, 0x11, 0x00, 0x83, 0x72, 0x69, 0x62, 0x67, 0x00, 0x04,
+    0x0B, 0x07, 0x04, 0x09, 0x04, 0x00, 0x84, 0x68, 0x64, 0x61, 0x6A, 0x67, 0x00, 0x40, 0x80, 0x01,
+    0x0C, 0x00, 0x3A, 0x0B, 0x4B, 0x0B, 0x57, 0x0B, 0x65, 0x0B, 0x16, 0x16, 0x08, 0x04, 0x15, 0x19,
+    0x00, 0x87, 0x61, 0x72, 0x65, 0x73, 0x73, 0x68, 0x6E, 0x67, 0x00, 0x0D, 0x0A, 0x04, 0x05, 0x12,
+    0x16, 0x00, 0x82, 0x6E, 0x69, 0x67, 0x00, 0x15, 0x04, 0x06, 0x15, 0x15, 0x0F, 0x00, 0x84, 0x72,
+    0x61, 0x73, 0x6E, 0x67, 0x00, 0x07, 0x09, 0x04, 0x09, 0x1A, 0x0A, 0x00, 0x81, 0x67, 0x6E, 0x00,
+    0x09, 0x07, 0x08, 0x0B, 0x14, 0x16, 0x00, 0x83, 0x66, 0x64, 0x6F, 0x67, 0x00, 0x06, 0x0A, 0x09,
+    0x11, 0x15, 0x08, 0x00, 0x83, 0x63, 0x67, 0x70, 0x67, 0x00, 0x4C, 0x91, 0x0B, 0x15, 0x9F, 0x0B,
+    0x00, 0x06, 0x0E, 0x10, 0x18, 0x10, 0x13, 0x09, 0x00, 0x83, 0x69, 0x63, 0x72, 0x67, 0x00, 0x0A,
+    0x12, 0x11, 0x0B, 0x04, 0x11, 0x17, 0x00, 0x84, 0x67, 0x6F, 0x72, 0x72, 0x67, 0x00, 0x48, 0xB8,
+    0x0B, 0x09, 0xC7, 0x0B, 0x10, 0xD2, 0x0B, 0x00, 0x0C, 0x08, 0x15, 0x1A, 0x11, 0x06, 0x11, 0x00,
+    0x84, 0x69, 0x65, 0x65, 0x73, 0x67, 0x00, 0x06, 0x0C, 0x11, 0x17, 0x00, 0x83, 0x66, 0x63, 0x73,
+    0x67, 0x00, 0x0F, 0x1C, 0x11, 0x17, 0x0B, 0x17, 0x1D, 0x00, 0x88, 0x68, 0x74, 0x74, 0x6E, 0x79,
+    0x6C, 0x6D, 0x73, 0x67, 0x00, 0x40, 0x9B, 0x67, 0xEB, 0x01, 0x0C, 0x0C, 0x39, 0x0C, 0x4B, 0x0C,
+    0x6C, 0x0C, 0xA3, 0x0C, 0xC3, 0x0C, 0xF2, 0x0C, 0xFF, 0x0C, 0x0E, 0x0D, 0x20, 0x0D, 0x40, 0x0D,
+    0x52, 0x0D, 0x73, 0x0D, 0x90, 0x0D, 0x9E, 0x0D, 0xAA, 0x0D, 0xB7, 0x0D, 0x4C, 0x16, 0x0C, 0x15,
+    0x21, 0x0C, 0x1D, 0x2D, 0x0C, 0x00, 0x18, 0x13, 0x0C, 0x0E, 0x00, 0x83, 0x69, 0x75, 0x61, 0x68,
+    0x00, 0x0C, 0x0B, 0x1D, 0x17, 0x04, 0x10, 0x00, 0x82, 0x61, 0x72, 0x68, 0x00, 0x09, 0x07, 0x11,
+    0x0C, 0x12, 0x15, 0x00, 0x82, 0x61, 0x7A, 0x68, 0x00, 0x12, 0x0F, 0x16, 0x11, 0x1C, 0x0F, 0x11,
+    0x2C, 0x00, 0x86, 0x6E, 0x79, 0x73, 0x6C, 0x6F, 0x62, 0x68, 0x00, 0x51, 0x52, 0x0C, 0x15, 0x63,
+    0x0C, 0x00, 0x11, 0x15, 0x0E, 0x12, 0x0F, 0x11, 0x00, 0x87, 0x6F, 0x6C, 0x6B, 0x72, 0x6E, 0x6E,
+    0x64, 0x68, 0x00, 0x17, 0x16, 0x0C, 0x08, 0x00, 0x81, 0x68, 0x64, 0x00, 0x44, 0x76, 0x0C, 0x17,
+    0x87, 0x0C, 0x1A, 0x95, 0x0C, 0x00, 0x07, 0x08, 0x15, 0x18, 0x0F, 0x17, 0x1B, 0x00, 0x86, 0x72,
+    0x75, 0x65, 0x64, 0x61, 0x65, 0x68, 0x00, 0x09, 0x1D, 0x0B, 0x18, 0x07, 0x17, 0x00, 0x84, 0x66,
+    0x7A, 0x74, 0x65, 0x68, 0x00, 0x0B, 0x0C, 0x12, 0x18, 0x08, 0x00, 0x85, 0x69, 0x6F, 0x68, 0x77,
+    0x65, 0x68, 0x00, 0x4D, 0xAA, 0x0C, 0x15, 0xB7, 0x0C, 0x00, 0x0C, 0x19, 0x04, 0x0A, 0x07, 0x08,
+    0x00, 0x83, 0x6A, 0x69, 0x68, 0x68, 0x00, 0x0A, 0x08, 0x19, 0x14, 0x17, 0x00, 0x83, 0x72, 0x67,
+    0x68, 0x68, 0x00, 0x47, 0xCD, 0x0C, 0x0F, 0xD8, 0x0C, 0x10, 0xE6, 0x0C, 0x00, 0x13, 0x08, 0x0C,
+    0x16, 0x00, 0x83, 0x64, 0x70, 0x69, 0x68, 0x00, 0x15, 0x17, 0x07, 0x11, 0x17, 0x00, 0x85, 0x74,
+    0x64, 0x72, 0x6C, 0x69, 0x68, 0x00, 0x12, 0x1D, 0x17, 0x08, 0x12, 0x00, 0x83, 0x6D, 0x6F, 0x69,
+    0x68, 0x00, 0x17, 0x04, 0x0A, 0x12, 0x0E, 0x00, 0x84, 0x61, 0x67, 0x74, 0x6A, 0x68, 0x00, 0x13,
+    0x08, 0x0D, 0x13, 0x11, 0x08, 0x00, 0x85, 0x6A, 0x70, 0x65, 0x70, 0x6B, 0x68, 0x00, 0x0A, 0x11,
+    0x0B, 0x1A, 0x15, 0x15, 0x0F, 0x0B, 0x00, 0x86, 0x77, 0x72, 0x68, 0x6E, 0x67, 0x6E, 0x68, 0x00,
+    0x44, 0x27, 0x0D, 0x16, 0x35, 0x0D, 0x00, 0x19, 0x13, 0x11, 0x17, 0x10, 0x00, 0x85, 0x70, 0x6E,
+    0x76, 0x61, 0x6F, 0x68, 0x00, 0x0B, 0x08, 0x08, 0x16, 0x04, 0x00, 0x82, 0x6F, 0x73, 0x68, 0x00,
+    0x0F, 0x0B, 0x11, 0x0E, 0x1C, 0x16, 0x1C, 0x18, 0x00, 0x86, 0x6B, 0x79, 0x6E, 0x68, 0x6C, 0x71,
+    0x68, 0x00, 0x4A, 0x59, 0x0D, 0x11, 0x67, 0x0D, 0x00, 0x04, 0x10, 0x0C, 0x16, 0x1A, 0x04, 0x00,
+    0x84, 0x61, 0x6D, 0x67, 0x72, 0x68, 0x00, 0x09, 0x07, 0x05, 0x0F, 0x07, 0x1C, 0x00, 0x82, 0x72,
+    0x6E, 0x68, 0x00, 0x10, 0x00, 0x47, 0x7C, 0x0D, 0x0E, 0x85, 0x0D, 0x00, 0x08, 0x16, 0x15, 0x0C,
+    0x00, 0x81, 0x68, 0x74, 0x00, 0x07, 0x07, 0x04, 0x16, 0x00, 0x83, 0x6D, 0x6B, 0x74, 0x68, 0x00,
+    0x18, 0x08, 0x07, 0x0E, 0x0C, 0x00, 0x85, 0x64, 0x6B, 0x65, 0x75, 0x76, 0x68, 0x00, 0x10, 0x12,
+    0x17, 0x17, 0x10, 0x04, 0x00, 0x82, 0x77, 0x6D, 0x68, 0x00, 0x0C, 0x1D, 0x1B, 0x0B, 0x17, 0x19,
+    0x06, 0x00, 0x82, 0x78, 0x69, 0x68, 0x00, 0x47, 0xC1, 0x0D, 0x0F, 0xD3, 0x0D, 0x11, 0xE2, 0x0D,
+    0x00, 0x0B, 0x0B, 0x14, 0x15, 0x06, 0x12, 0x15, 0x00, 0x87, 0x72, 0x63, 0x71, 0x68, 0x68, 0x64,
+    0x79, 0x68, 0x00, 0x1A, 0x0D, 0x04, 0x16, 0x0C, 0x16, 0x16, 0x00, 0x84, 0x77, 0x6A, 0x6C, 0x79,
+    0x68, 0x00, 0x0C, 0x0A, 0x04, 0x18, 0x00, 0x82, 0x79, 0x6E, 0x68, 0x00, 0x40, 0xF9, 0x71, 0x5E,
+    0x00, 0x0F, 0x0E, 0x5B, 0x0E, 0x6B, 0x0E, 0xA8, 0x0E, 0xB5, 0x0E, 0xD9, 0x0E, 0xF8, 0x0E, 0x08,
+    0x0F, 0x54, 0x0F, 0x64, 0x0F, 0x70, 0x0F, 0x7C, 0x0F, 0x8C, 0x0F, 0x9E, 0x0F, 0xAF, 0x0F, 0x40,
+    0x80, 0x01, 0x40, 0x02, 0x1C, 0x0E, 0x2D, 0x0E, 0x39, 0x0E, 0x4A, 0x0E, 0x0C, 0x13, 0x17, 0x0B,
+    0x07, 0x08, 0x17, 0x00, 0x86, 0x74, 0x68, 0x70, 0x69, 0x68, 0x61, 0x69, 0x00, 0x0B, 0x34, 0x08,
+    0x07, 0x0A, 0x00, 0x84, 0x69, 0x68, 0x61, 0x69, 0x00, 0x0A, 0x15, 0x17, 0x14, 0x0B, 0x06, 0x12,
+    0x00, 0x86, 0x74, 0x71, 0x72, 0x67, 0x77, 0x61, 0x69, 0x00, 0x15, 0x11, 0x06, 0x0F, 0x0F, 0x0A,
+    0x16, 0x00, 0x86, 0x63, 0x6C, 0x6E, 0x72, 0x7A, 0x61, 0x69, 0x00, 0x0F, 0x04, 0x12, 0x16, 0x06,
+    0x0D, 0x0B, 0x00, 0x85, 0x6F, 0x73, 0x61, 0x6C, 0x64, 0x69, 0x00, 0x40, 0x01, 0x41, 0x02, 0x00,
+    0x78, 0x0E, 0x83, 0x0E, 0x91, 0x0E, 0x9E, 0x0E, 0x07, 0x04, 0x0B, 0x08, 0x0B, 0x07, 0x00, 0x81,
+    0x69, 0x65, 0x00, 0x11, 0x16, 0x06, 0x14, 0x07, 0x00, 0x85, 0x73, 0x63, 0x6E, 0x69, 0x65, 0x69,
+    0x00, 0x1D, 0x1D, 0x05, 0x0A, 0x17, 0x17, 0x00, 0x83, 0x6F, 0x7A, 0x65, 0x69, 0x00, 0x15, 0x13,
+    0x16, 0x04, 0x00, 0x82, 0x65, 0x72, 0x69, 0x00, 0x08, 0x04, 0x07, 0x11, 0x10, 0x11, 0x0A, 0x04,
+    0x00, 0x81, 0x69, 0x66, 0x00, 0x56, 0xBC, 0x0E, 0x18, 0xC7, 0x0E, 0x00, 0x12, 0x17, 0x17, 0x0F,
+    0x00, 0x83, 0x73, 0x6F, 0x67, 0x69, 0x00, 0x0C, 0x14, 0x0B, 0x19, 0x34, 0x16, 0x05, 0x08, 0x00,
+    0x87, 0x76, 0x68, 0x69, 0x71, 0x75, 0x67, 0x69, 0x00, 0x56, 0xE0, 0x0E, 0x1C, 0xEC, 0x0E, 0x00,
+    0x0C, 0x08, 0x0F, 0x11, 0x00, 0x84, 0x69, 0x65, 0x73, 0x68, 0x69, 0x00, 0x12, 0x11, 0x0B, 0x10,
+    0x04, 0x08, 0x06, 0x00, 0x81, 0x69, 0x68, 0x00, 0x14, 0x1C, 0x15, 0x07, 0x0B, 0x11, 0x17, 0x00,
+    0x85, 0x72, 0x64, 0x79, 0x71, 0x69, 0x69, 0x00, 0x40, 0x41, 0x08, 0x00, 0x01, 0x15, 0x0F, 0x22,
+    0x0F, 0x35, 0x0F, 0x42, 0x0F, 0x0A, 0x12, 0x15, 0x07, 0x1A, 0x16, 0x15, 0x00, 0x82, 0x6D, 0x61,
+    0x69, 0x00, 0x11, 0x16, 0x1C, 0x11, 0x04, 0x07, 0x17, 0x00, 0x88, 0x61, 0x64, 0x6E, 0x79, 0x73,
+    0x6E, 0x67, 0x6D, 0x69, 0x00, 0x06, 0x11, 0x0B, 0x16, 0x00, 0x85, 0x6E, 0x68, 0x63, 0x6C, 0x6D,
+    0x69, 0x00, 0x08, 0x14, 0x0B, 0x09, 0x08, 0x18, 0x0C, 0x00, 0x87, 0x66, 0x65, 0x68, 0x71, 0x65,
+    0x79, 0x6D, 0x69, 0x00, 0x0B, 0x0C, 0x08, 0x11, 0x06, 0x0B, 0x00, 0x86, 0x6E, 0x63, 0x65, 0x69,
+    0x68, 0x6E, 0x69, 0x00, 0x15, 0x16, 0x07, 0x04, 0x10, 0x1A, 0x07, 0x00, 0x81, 0x69, 0x6F, 0x00,
+    0x04, 0x18, 0x15, 0x0A, 0x0C, 0x0C, 0x07, 0x00, 0x81, 0x69, 0x72, 0x00, 0x07, 0x09, 0x08, 0x04,
+    0x12, 0x09, 0x0B, 0x08, 0x00, 0x84, 0x66, 0x65, 0x64, 0x73, 0x69, 0x00, 0x0A, 0x04, 0x0D, 0x06,
+    0x15, 0x10, 0x0C, 0x00, 0x87, 0x72, 0x6D, 0x63, 0x6A, 0x61, 0x67, 0x74, 0x69, 0x00, 0x0C, 0x0F,
+    0x1A, 0x08, 0x18, 0x0A, 0x13, 0x0E, 0x00, 0x85, 0x77, 0x65, 0x6C, 0x69, 0x75, 0x69, 0x00, 0x18,
+    0x0F, 0x08, 0x0D, 0x16, 0x00, 0x85, 0x65, 0x6A, 0x6C, 0x75, 0x77, 0x69, 0x00, 0x40, 0x0D, 0x61,
+    0x44, 0x00, 0xD2, 0x0F, 0xF5, 0x0F, 0x00, 0x10, 0x0E, 0x10, 0x1E, 0x10, 0x30, 0x10, 0x4F, 0x10,
+    0x5A, 0x10, 0x4C, 0xD9, 0x0F, 0x12, 0xE4, 0x0F, 0x00, 0x15, 0x1A, 0x16, 0x11, 0x00, 0x83, 0x69,
+    0x72, 0x61, 0x6A, 0x00, 0x04, 0x15, 0x11, 0x1C, 0x16, 0x1C, 0x16, 0x00, 0x86, 0x6E, 0x79, 0x72,
+    0x61, 0x6F, 0x61, 0x6A, 0x00, 0x16, 0x0B, 0x07, 0x0F, 0x07, 0x00, 0x82, 0x63, 0x73, 0x6A, 0x00,
+    0x08, 0x15, 0x15, 0x16, 0x06, 0x1A, 0x09, 0x2C, 0x00, 0x82, 0x64, 0x65, 0x6A, 0x00, 0x15, 0x0B,
+    0x10, 0x17, 0x1D, 0x15, 0x17, 0x00, 0x85, 0x6D, 0x74, 0x68, 0x72, 0x69, 0x6A, 0x00, 0x10, 0x1D,
+    0x0F, 0x08, 0x08, 0x0C, 0x04, 0x00, 0x87, 0x65, 0x69, 0x65, 0x6C, 0x7A, 0x6D, 0x6E, 0x6A, 0x00,
+    0x4E, 0x37, 0x10, 0x15, 0x44, 0x10, 0x00, 0x04, 0x1C, 0x1C, 0x11, 0x09, 0x00, 0x84, 0x61, 0x79,
+    0x6B, 0x6F, 0x6A, 0x00, 0x07, 0x10, 0x08, 0x0C, 0x00, 0x83, 0x72, 0x64, 0x6F, 0x6A, 0x00, 0x12,
+    0x07, 0x0C, 0x06, 0x06, 0x04, 0x00, 0x81, 0x6A, 0x73, 0x00, 0x04, 0x17, 0x0C, 0x0D, 0x11, 0x0B,
+    0x1B, 0x00, 0x85, 0x69, 0x6A, 0x74, 0x61, 0x77, 0x6A, 0x00, 0x40, 0x09, 0x10, 0x82, 0x00, 0x79,
+    0x10, 0xA8, 0x10, 0xBA, 0x10, 0xCC, 0x10, 0xD7, 0x10, 0x48, 0x83, 0x10, 0x12, 0x8D, 0x10, 0x1D,
+    0x99, 0x10, 0x00, 0x0C, 0x0B, 0x08, 0x09, 0x00, 0x82, 0x61, 0x65, 0x6B, 0x00, 0x08, 0x1A, 0x12,
+    0x11, 0x04, 0x09, 0x00, 0x82, 0x61, 0x6F, 0x6B, 0x00, 0x0B, 0x0C, 0x16, 0x0A, 0x15, 0x1C, 0x00,
+    0x85, 0x69, 0x73, 0x68, 0x7A, 0x61, 0x6B, 0x00, 0x1C, 0x09, 0x11, 0x11, 0x1C, 0x15, 0x0C, 0x13,
+    0x00, 0x86, 0x6E, 0x79, 0x6E, 0x66, 0x79, 0x64, 0x6B, 0x00, 0x18, 0x0C, 0x15, 0x15, 0x1D, 0x16,
+    0x15, 0x00, 0x87, 0x7A, 0x73, 0x72, 0x72, 0x69, 0x75, 0x6D, 0x6B, 0x00, 0x12, 0x1B, 0x19, 0x0E,
+    0x0D, 0x15, 0x00, 0x81, 0x6B, 0x72, 0x00, 0x1B, 0x0C, 0x16, 0x16, 0x18, 0x13, 0x00, 0x84, 0x69,
+    0x73, 0x78, 0x78, 0x6B, 0x00, 0x40, 0x99, 0x61, 0x7E, 0x00, 0x04, 0x11, 0x13, 0x11, 0x31, 0x11,
+    0x43, 0x11, 0x4E, 0x11, 0x7B, 0x11, 0x8B, 0x11, 0xAB, 0x11, 0xB8, 0x11, 0xD8, 0x11, 0xE9, 0x11,
+    0x0B, 0x12, 0x19, 0x12, 0x12, 0x1A, 0x04, 0x0B, 0x17, 0x0A, 0x14, 0x0A, 0x00, 0x83, 0x6F, 0x77,
+    0x61, 0x6C, 0x00, 0x48, 0x1A, 0x11, 0x15, 0x25, 0x11, 0x00, 0x1A, 0x06, 0x07, 0x0B, 0x07, 0x16,
+    0x00, 0x81, 0x6C, 0x64, 0x00, 0x07, 0x17, 0x0C, 0x12, 0x00, 0x84, 0x64, 0x74, 0x72, 0x64, 0x6C,
+    0x00, 0x0E, 0x0C, 0x16, 0x10, 0x0B, 0x12, 0x15, 0x00, 0x87, 0x68, 0x6F, 0x6D, 0x73, 0x69, 0x6B,
+    0x65, 0x6C, 0x00, 0x0C, 0x0C, 0x04, 0x1A, 0x12, 0x00, 0x82, 0x68, 0x69, 0x6C, 0x00, 0x48, 0x58,
+    0x11, 0x11, 0x64, 0x11, 0x17, 0x71, 0x11, 0x00, 0x07, 0x0C, 0x12, 0x14, 0x13, 0x00, 0x83, 0x65,
+    0x64, 0x69, 0x6C, 0x00, 0x17, 0x16, 0x15, 0x17, 0x00, 0x85, 0x73, 0x72, 0x74, 0x6E, 0x69, 0x6C,
+    0x00, 0x0A, 0x0E, 0x09, 0x0C, 0x00, 0x82, 0x69, 0x74, 0x6C, 0x00, 0x04, 0x12, 0x16, 0x11, 0x18,
+    0x15, 0x0A, 0x17, 0x00, 0x84, 0x6F, 0x73, 0x61, 0x6E, 0x6C, 0x00, 0x4C, 0x92, 0x11, 0x15, 0x9E,
+    0x11, 0x00, 0x08, 0x1B, 0x0F, 0x08, 0x00, 0x84, 0x65, 0x78, 0x69, 0x6F, 0x6C, 0x00, 0x04, 0x14,
+    0x15, 0x11, 0x00, 0x85, 0x71, 0x72, 0x61, 0x72, 0x6F, 0x6C, 0x00, 0x0A, 0x17, 0x0F, 0x12, 0x15,
+    0x06, 0x00, 0x83, 0x67, 0x74, 0x72, 0x6C, 0x00, 0x48, 0xBF, 0x11, 0x12, 0xCC, 0x11, 0x00, 0x06,
+    0x12, 0x06, 0x11, 0x12, 0x11, 0x11, 0x00, 0x82, 0x73, 0x65, 0x6C, 0x00, 0x06, 0x17, 0x0E, 0x04,
+    0x0B, 0x0C, 0x00, 0x82, 0x73, 0x6F, 0x6C, 0x00, 0x10, 0x1C, 0x04, 0x15, 0x16, 0x15, 0x18, 0x00,
+    0x86, 0x72, 0x73, 0x61, 0x79, 0x6D, 0x74, 0x6C, 0x00, 0x12, 0x00, 0x47, 0xF2, 0x11, 0x0F, 0xFE,
+    0x11, 0x00, 0x1A, 0x0C, 0x12, 0x12, 0x00, 0x84, 0x64, 0x77, 0x6F, 0x75, 0x6C, 0x00, 0x16, 0x13,
+    0x15, 0x04, 0x0C, 0x00, 0x84, 0x6C, 0x73, 0x6F, 0x75, 0x6C, 0x00, 0x15, 0x15, 0x10, 0x12, 0x19,
+    0x11, 0x0B, 0x04, 0x00, 0x82, 0x76, 0x72, 0x6C, 0x00, 0x46, 0x20, 0x12, 0x0A, 0x2D, 0x12, 0x00,
+    0x11, 0x10, 0x0C, 0x04, 0x00, 0x85, 0x6D, 0x69, 0x6E, 0x63, 0x77, 0x6C, 0x00, 0x12, 0x0C, 0x0F,
+    0x09, 0x1C, 0x08, 0x17, 0x00, 0x81, 0x6C, 0x77, 0x00, 0x40, 0x9B, 0xC1, 0x42, 0x01, 0x54, 0x12,
+    0x74, 0x12, 0x87, 0x12, 0x98, 0x12, 0xBB, 0x12, 0xD7, 0x12, 0xE5, 0x12, 0xF3, 0x12, 0x05, 0x13,
+    0x11, 0x13, 0x21, 0x13, 0x44, 0x5B, 0x12, 0x0F, 0x69, 0x12, 0x00, 0x0C, 0x0B, 0x04, 0x15, 0x08,
+    0x00, 0x85, 0x68, 0x61, 0x69, 0x61, 0x61, 0x6D, 0x00, 0x16, 0x15, 0x0F, 0x1C, 0x00, 0x83, 0x6C,
+    0x73, 0x61, 0x6D, 0x00, 0x0B, 0x1C, 0x17, 0x07, 0x11, 0x34, 0x15, 0x09, 0x04, 0x00, 0x87, 0x6E,
+    0x64, 0x79, 0x74, 0x68, 0x62, 0x6D, 0x00, 0x04, 0x17, 0x17, 0x12, 0x16, 0x1C, 0x1C, 0x17, 0x00,
+    0x85, 0x74, 0x6F, 0x74, 0x61, 0x64, 0x6D, 0x00, 0x55, 0x9F, 0x12, 0x17, 0xAB, 0x12, 0x00, 0x0B,
+    0x0C, 0x1A, 0x10, 0x11, 0x2C, 0x00, 0x82, 0x65, 0x72, 0x6D, 0x00, 0x18, 0x08, 0x0C, 0x04, 0x0F,
+    0x1C, 0x1C, 0x00, 0x85, 0x65, 0x69, 0x75, 0x74, 0x65, 0x6D, 0x00, 0x4B, 0xC2, 0x12, 0x12, 0xCD,
+    0x12, 0x00, 0x17, 0x11, 0x10, 0x04, 0x00, 0x83, 0x68, 0x74, 0x68, 0x6D, 0x00, 0x0B, 0x14, 0x16,
+    0x12, 0x00, 0x82, 0x68, 0x6F, 0x6D, 0x00, 0x15, 0x19, 0x08, 0x1A, 0x11, 0x00, 0x85, 0x65, 0x77,
+    0x76, 0x72, 0x69, 0x6D, 0x00, 0x0C, 0x17, 0x08, 0x0D, 0x0F, 0x00, 0x85, 0x65, 0x6A, 0x74, 0x69,
+    0x6F, 0x6D, 0x00, 0x10, 0x18, 0x07, 0x15, 0x19, 0x15, 0x0F, 0x00, 0x87, 0x76, 0x72, 0x72, 0x64,
+    0x75, 0x6D, 0x70, 0x6D, 0x00, 0x15, 0x12, 0x15, 0x12, 0x10, 0x0D, 0x2C, 0x00, 0x81, 0x6D, 0x72,
+    0x00, 0x0F, 0x12, 0x15, 0x0C, 0x14, 0x0C, 0x00, 0x86, 0x69, 0x71, 0x72, 0x6F, 0x6C, 0x77, 0x6D,
+    0x00, 0x08, 0x07, 0x16, 0x13, 0x11, 0x0C, 0x00, 0x82, 0x79, 0x65, 0x6D, 0x00, 0x40, 0xFF, 0xBF,
+    0x9E, 0x00, 0x5A, 0x13, 0x74, 0x13, 0x81, 0x13, 0xB3, 0x13, 0x02, 0x14, 0x43, 0x14, 0x61, 0x14,
+    0x93, 0x14, 0xB5, 0x14, 0xD4, 0x14, 0xE3, 0x14, 0x0A, 0x15, 0x2F, 0x15, 0x52, 0x15, 0x7D, 0x15,
+    0x8F, 0x15, 0x9B, 0x15, 0xB9, 0x15, 0xDA, 0x15, 0xEC, 0x15, 0x57, 0x61, 0x13, 0x1A, 0x6A, 0x13,
+    0x00, 0x12, 0x0C, 0x13, 0x16, 0x00, 0x81, 0x6E, 0x61, 0x00, 0x17, 0x0C, 0x0B, 0x04, 0x00, 0x82,
+    0x61, 0x77, 0x6E, 0x00, 0x12, 0x0F, 0x17, 0x04, 0x04, 0x0A, 0x11, 0x00, 0x82, 0x62, 0x6F, 0x6E,
+    0x00, 0x45, 0x8B, 0x13, 0x08, 0x9E, 0x13, 0x18, 0xA9, 0x13, 0x00, 0x09, 0x14, 0x17, 0x08, 0x06,
+    0x11, 0x13, 0x00, 0x88, 0x63, 0x6E, 0x65, 0x74, 0x71, 0x66, 0x62, 0x63, 0x6E, 0x00, 0x0C, 0x12,
+    0x11, 0x08, 0x00, 0x83, 0x65, 0x69, 0x63, 0x6E, 0x00, 0x0C, 0x0F, 0x04, 0x17, 0x0B, 0x00, 0x81,
+    0x6E, 0x63, 0x00, 0x40, 0x00, 0x12, 0x0C, 0x02, 0xC2, 0x13, 0xCD, 0x13, 0xD8, 0x13, 0xE4, 0x13,
+    0xEF, 0x13, 0x0C, 0x0C, 0x1C, 0x07, 0x00, 0x83, 0x6A, 0x69, 0x64, 0x6E, 0x00, 0x12, 0x04, 0x08,
+    0x12, 0x00, 0x83, 0x6D, 0x6F, 0x64, 0x6E, 0x00, 0x15, 0x17, 0x0F, 0x1A, 0x00, 0x84, 0x72, 0x74,
+    0x73, 0x64, 0x6E, 0x00, 0x12, 0x0B, 0x17, 0x1A, 0x00, 0x83, 0x74, 0x6F, 0x64, 0x6E, 0x00, 0x0C,
+    0x18, 0x12, 0x17, 0x0A, 0x1C, 0x1A, 0x00, 0x88, 0x67, 0x79, 0x74, 0x6F, 0x75, 0x69, 0x7A, 0x64,
+    0x6E, 0x00, 0x40, 0x48, 0x21, 0x00, 0x00, 0x0F, 0x14, 0x1E, 0x14, 0x2C, 0x14, 0x38, 0x14, 0x17,
+    0x16, 0x15, 0x0B, 0x1C, 0x12, 0x04, 0x00, 0x84, 0x74, 0x73, 0x64, 0x65, 0x6E, 0x00, 0x11, 0x17,
+    0x0A, 0x0C, 0x11, 0x0B, 0x08, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x6E, 0x00, 0x16, 0x07, 0x15, 0x12,
+    0x07, 0x0B, 0x00, 0x82, 0x65, 0x69, 0x6E, 0x00, 0x1C, 0x1C, 0x06, 0x17, 0x18, 0x0E, 0x00, 0x81,
+    0x6E, 0x65, 0x00, 0x46, 0x4A, 0x14, 0x08, 0x54, 0x14, 0x00, 0x08, 0x15, 0x19, 0x07, 0x0B, 0x00,
+    0x81, 0x6E, 0x66, 0x00, 0x04, 0x13, 0x11, 0x16, 0x07, 0x17, 0x12, 0x00, 0x82, 0x66, 0x65, 0x6E,
+    0x00, 0x47, 0x6B, 0x14, 0x08, 0x7A, 0x14, 0x1C, 0x88, 0x14, 0x00, 0x15, 0x07, 0x16, 0x15, 0x08,
+    0x17, 0x00, 0x85, 0x64, 0x73, 0x72, 0x64, 0x67, 0x6E, 0x00, 0x1A, 0x12, 0x17, 0x0A, 0x2C, 0x00,
+    0x85, 0x6F, 0x74, 0x77, 0x65, 0x67, 0x6E, 0x00, 0x17, 0x11, 0x1C, 0x0C, 0x00, 0x83, 0x79, 0x74,
+    0x67, 0x6E, 0x00, 0x4B, 0x9A, 0x14, 0x10, 0xAB, 0x14, 0x00, 0x04, 0x12, 0x09, 0x15, 0x0F, 0x08,
+    0x0C, 0x00, 0x86, 0x66, 0x72, 0x6F, 0x61, 0x68, 0x68, 0x6E, 0x00, 0x17, 0x11, 0x12, 0x08, 0x16,
+    0x00, 0x81, 0x6E, 0x68, 0x00, 0x52, 0xBC, 0x14, 0x1C, 0xCA, 0x14, 0x00, 0x18, 0x07, 0x13, 0x07,
+    0x1C, 0x00, 0x85, 0x64, 0x70, 0x75, 0x6F, 0x69, 0x6E, 0x00, 0x17, 0x05, 0x0E, 0x12, 0x05, 0x00,
+    0x81, 0x6E, 0x69, 0x00, 0x13, 0x04, 0x15, 0x08, 0x17, 0x14, 0x00, 0x85, 0x72, 0x65, 0x61, 0x70,
+    0x6A, 0x6E, 0x00, 0x50, 0xEA, 0x14, 0x17, 0xFD, 0x14, 0x00, 0x06, 0x07, 0x0B, 0x06, 0x0C, 0x17,
+    0x11, 0x00, 0x88, 0x69, 0x74, 0x63, 0x68, 0x64, 0x63, 0x6D, 0x6B, 0x6E, 0x00, 0x18, 0x0B, 0x11,
+    0x17, 0x00, 0x85, 0x68, 0x6E, 0x75, 0x74, 0x6B, 0x6E, 0x00, 0x4E, 0x11, 0x15, 0x10, 0x20, 0x15,
+    0x00, 0x10, 0x17, 0x04, 0x1C, 0x04, 0x15, 0x0B, 0x00, 0x84, 0x6D, 0x74, 0x6B, 0x6C, 0x6E, 0x00,
+    0x1A, 0x0F, 0x16, 0x14, 0x0E, 0x2C, 0x00, 0x85, 0x6C, 0x73, 0x77, 0x6D, 0x6C, 0x6E, 0x00, 0x47,
+    0x36, 0x15, 0x0B, 0x45, 0x15, 0x00, 0x07, 0x16, 0x09, 0x04, 0x07, 0x00, 0x86, 0x66, 0x61, 0x73,
+    0x64, 0x64, 0x6D, 0x6E, 0x00, 0x1D, 0x1A, 0x12, 0x18, 0x08, 0x00, 0x84, 0x7A, 0x77, 0x68, 0x6D,
+    0x6E, 0x00, 0x4B, 0x59, 0x15, 0x0F, 0x6B, 0x15, 0x00, 0x08, 0x0C, 0x0C, 0x12, 0x34, 0x08, 0x15,
+    0x07, 0x00, 0x87, 0x6F, 0x69, 0x69, 0x68, 0x65, 0x6E, 0x6E, 0x00, 0x19, 0x07, 0x16, 0x15, 0x1A,
+    0x09, 0x2C, 0x00, 0x87, 0x72, 0x77, 0x73, 0x64, 0x76, 0x6C, 0x6E, 0x6E, 0x00, 0x04, 0x17, 0x11,
+    0x04, 0x0B, 0x0F, 0x0F, 0x15, 0x00, 0x86, 0x61, 0x68, 0x6E, 0x74, 0x61, 0x70, 0x6E, 0x00, 0x0C,
+    0x07, 0x1C, 0x08, 0x12, 0x00, 0x83, 0x69, 0x64, 0x72, 0x6E, 0x00, 0x4B, 0xA2, 0x15, 0x10, 0xAB,
+    0x15, 0x00, 0x15, 0x1C, 0x0E, 0x0C, 0x00, 0x81, 0x6E, 0x73, 0x00, 0x0A, 0x08, 0x1B, 0x04, 0x15,
+    0x16, 0x17, 0x00, 0x83, 0x6D, 0x67, 0x73, 0x6E, 0x00, 0x44, 0xC0, 0x15, 0x11, 0xCE, 0x15, 0x00,
+    0x0C, 0x16, 0x10, 0x09, 0x1C, 0x07, 0x11, 0x00, 0x83, 0x61, 0x69, 0x74, 0x6E, 0x00, 0x06, 0x04,
+    0x13, 0x0C, 0x00, 0x84, 0x63, 0x61, 0x6E, 0x74, 0x6E, 0x00, 0x1C, 0x08, 0x07, 0x08, 0x09, 0x12,
+    0x16, 0x18, 0x00, 0x86, 0x65, 0x66, 0x64, 0x65, 0x79, 0x75, 0x6E, 0x00, 0x08, 0x12, 0x09, 0x12,
+    0x04, 0x11, 0x00, 0x81, 0x6E, 0x78, 0x00, 0x40, 0xFD, 0xE9, 0x4E, 0x00, 0x1C, 0x16, 0x2A, 0x16,
+    0x4B, 0x16, 0x6D, 0x16, 0xC0, 0x16, 0xE0, 0x16, 0xEE, 0x16, 0x10, 0x17, 0x1D, 0x17, 0x3A, 0x17,
+    0x7B, 0x17, 0xB7, 0x17, 0xDD, 0x17, 0xE7, 0x17, 0xF8, 0x17, 0x1A, 0x18, 0x15, 0x0C, 0x08, 0x12,
+    0x0C, 0x07, 0x11, 0x00, 0x83, 0x72, 0x69, 0x61, 0x6F, 0x00, 0x45, 0x31, 0x16, 0x15, 0x41, 0x16,
+    0x00, 0x17, 0x0B, 0x11, 0x13, 0x18, 0x07, 0x00, 0x86, 0x6E, 0x70, 0x68, 0x74, 0x62, 0x63, 0x6F,
+    0x00, 0x18, 0x0A, 0x0E, 0x1D, 0x00, 0x82, 0x63, 0x72, 0x6F, 0x00, 0x4B, 0x52, 0x16, 0x12, 0x60,
+    0x16, 0x00, 0x17, 0x05, 0x10, 0x17, 0x0B, 0x00, 0x85, 0x62, 0x6D, 0x74, 0x68, 0x64, 0x6F, 0x00,
+    0x11, 0x15, 0x08, 0x07, 0x00, 0x85, 0x72, 0x65, 0x6E, 0x6F, 0x64, 0x6F, 0x00, 0x40, 0x04, 0x00,
+    0x22, 0x01, 0x7A, 0x16, 0x86, 0x16, 0xA6, 0x16, 0xB2, 0x16, 0x0A, 0x11, 0x14, 0x0D, 0x07, 0x09,
+    0x18, 0x00, 0x81, 0x6F, 0x65, 0x00, 0x48, 0x8D, 0x16, 0x17, 0x9A, 0x16, 0x00, 0x04, 0x11, 0x1B,
+    0x07, 0x00, 0x85, 0x61, 0x6E, 0x65, 0x72, 0x65, 0x6F, 0x00, 0x1B, 0x0B, 0x0F, 0x00, 0x85, 0x78,
+    0x68, 0x74, 0x72, 0x65, 0x6F, 0x00, 0x15, 0x11, 0x0C, 0x17, 0x0A, 0x1A, 0x12, 0x00, 0x81, 0x6F,
+    0x65, 0x00, 0x07, 0x18, 0x17, 0x08, 0x18, 0x00, 0x85, 0x75, 0x74, 0x64, 0x79, 0x65, 0x6F, 0x00,
+    0x57, 0xC7, 0x16, 0x1C, 0xD1, 0x16, 0x00, 0x0D, 0x15, 0x0C, 0x18, 0x13, 0x00, 0x81, 0x6F, 0x66,
+    0x00, 0x08, 0x17, 0x07, 0x1C, 0x09, 0x00, 0x86, 0x64, 0x79, 0x74, 0x65, 0x79, 0x66, 0x6F, 0x00,
+    0x06, 0x0C, 0x17, 0x16, 0x04, 0x0C, 0x18, 0x1A, 0x00, 0x82, 0x67, 0x63, 0x6F, 0x00, 0x4D, 0xF5,
+    0x16, 0x17, 0x03, 0x17, 0x00, 0x16, 0x0F, 0x0C, 0x0C, 0x07, 0x00, 0x85, 0x6C, 0x69, 0x73, 0x6A,
+    0x68, 0x6F, 0x00, 0x09, 0x18, 0x04, 0x06, 0x00, 0x85, 0x75, 0x61, 0x66, 0x74, 0x68, 0x6F, 0x00,
+    0x17, 0x06, 0x10, 0x12, 0x16, 0x0C, 0x15, 0x00, 0x82, 0x69, 0x74, 0x6F, 0x00, 0x4B, 0x24, 0x17,
+    0x12, 0x2D, 0x17, 0x00, 0x16, 0x06, 0x19, 0x06, 0x00, 0x81, 0x6F, 0x6C, 0x00, 0x0E, 0x1D, 0x0C,
+    0x17, 0x17, 0x12, 0x00, 0x83, 0x6F, 0x6B, 0x6C, 0x6F, 0x00, 0x40, 0x00, 0x20, 0x0C, 0x01, 0x47,
+    0x17, 0x56, 0x17, 0x61, 0x17, 0x70, 0x17, 0x07, 0x07, 0x1A, 0x0C, 0x0B, 0x2C, 0x00, 0x85, 0x64,
+    0x77, 0x64, 0x6E, 0x6E, 0x6F, 0x00, 0x16, 0x0F, 0x0E, 0x04, 0x06, 0x00, 0x82, 0x6E, 0x73, 0x6F,
+    0x00, 0x1A, 0x06, 0x0B, 0x08, 0x16, 0x0F, 0x1A, 0x00, 0x84, 0x77, 0x63, 0x74, 0x6E, 0x6F, 0x00,
+    0x14, 0x0B, 0x0C, 0x15, 0x07, 0x04, 0x00, 0x81, 0x6F, 0x6E, 0x00, 0x4A, 0x85, 0x17, 0x12, 0x96,
+    0x17, 0x15, 0xA8, 0x17, 0x00, 0x12, 0x17, 0x04, 0x1C, 0x06, 0x17, 0x00, 0x87, 0x79, 0x63, 0x61,
+    0x74, 0x6F, 0x67, 0x6F, 0x6F, 0x00, 0x0C, 0x16, 0x08, 0x07, 0x11, 0x17, 0x15, 0x00, 0x87, 0x64,
+    0x6E, 0x65, 0x73, 0x69, 0x6F, 0x6F, 0x6F, 0x00, 0x15, 0x11, 0x0E, 0x17, 0x1A, 0x00, 0x86, 0x6B,
+    0x74, 0x6E, 0x72, 0x72, 0x6F, 0x6F, 0x00, 0x49, 0xBE, 0x17, 0x11, 0xD0, 0x17, 0x00, 0x18, 0x14,
+    0x1A, 0x08, 0x16, 0x07, 0x11, 0x00, 0x87, 0x65, 0x73, 0x77, 0x71, 0x75, 0x66, 0x70, 0x6F, 0x00,
+    0x0F, 0x0B, 0x1A, 0x15, 0x0B, 0x00, 0x84, 0x6C, 0x68, 0x6E, 0x70, 0x6F, 0x00, 0x08, 0x0E, 0x17,
+    0x07, 0x04, 0x00, 0x81, 0x6F, 0x72, 0x00, 0x07, 0x06, 0x0C, 0x34, 0x11, 0x12, 0x11, 0x00, 0x87,
+    0x6E, 0x6F, 0x69, 0x63, 0x64, 0x73, 0x6F, 0x00, 0x16, 0x00, 0x4B, 0x01, 0x18, 0x10, 0x0A, 0x18,
+    0x00, 0x16, 0x0F, 0x07, 0x00, 0x82, 0x74, 0x73, 0x6F, 0x00, 0x07, 0x06, 0x18, 0x0C, 0x0B, 0x17,
+    0x00, 0x86, 0x63, 0x75, 0x64, 0x6D, 0x73, 0x74, 0x6F, 0x00, 0x44, 0x21, 0x18, 0x07, 0x31, 0x18,
+    0x00, 0x0F, 0x11, 0x10, 0x12, 0x04, 0x0B, 0x00, 0x86, 0x6D, 0x6F, 0x6E, 0x6C, 0x61, 0x77, 0x6F,
+    0x00, 0x15, 0x18, 0x11, 0x1A, 0x19, 0x17, 0x00, 0x81, 0x6F, 0x77, 0x00, 0x40, 0x48, 0x24, 0x40,
+    0x00, 0x4B, 0x18, 0x6B, 0x18, 0x8F, 0x18, 0xA3, 0x18, 0xB3, 0x18, 0x45, 0x52, 0x18, 0x1A, 0x60,
+    0x18, 0x00, 0x0A, 0x08, 0x10, 0x16, 0x1A, 0x07, 0x00, 0x84, 0x67, 0x65, 0x62, 0x64, 0x70, 0x00,
+    0x0A, 0x09, 0x1C, 0x08, 0x00, 0x83, 0x77, 0x67, 0x64, 0x70, 0x00, 0x4D, 0x72, 0x18, 0x1B, 0x7F,
+    0x18, 0x00, 0x17, 0x16, 0x15, 0x0F, 0x00, 0x85, 0x73, 0x72, 0x74, 0x6A, 0x67, 0x70, 0x00, 0x12,
+    0x0A, 0x08, 0x07, 0x12, 0x07, 0x0C, 0x00, 0x85, 0x67, 0x65, 0x6F, 0x78, 0x67, 0x70, 0x00, 0x0B,
+    0x16, 0x11, 0x17, 0x11, 0x0B, 0x08, 0x04, 0x00, 0x88, 0x68, 0x65, 0x6E, 0x74, 0x6E, 0x73, 0x68,
+    0x6B, 0x70, 0x00, 0x0F, 0x16, 0x12, 0x04, 0x08, 0x08, 0x00, 0x86, 0x61, 0x65, 0x6F, 0x73, 0x6C,
+    0x6E, 0x70, 0x00, 0x04, 0x10, 0x13, 0x0A, 0x0C, 0x34, 0x17, 0x04, 0x04, 0x00, 0x87, 0x69, 0x70,
+    0x67, 0x6D, 0x61, 0x77, 0x70, 0x00, 0x40, 0x16, 0x40, 0x08, 0x00, 0xD5, 0x18, 0xE4, 0x18, 0xF0,
+    0x18, 0xFD, 0x18, 0x08, 0x19, 0x11, 0x06, 0x0C, 0x0F, 0x12, 0x1C, 0x00, 0x85, 0x69, 0x6C, 0x63,
+    0x6E, 0x62, 0x71, 0x00, 0x12, 0x07, 0x07, 0x16, 0x0B, 0x17, 0x06, 0x00, 0x81, 0x71, 0x63, 0x00,
+    0x07, 0x15, 0x14, 0x13, 0x0A, 0x0C, 0x15, 0x00, 0x82, 0x65, 0x64, 0x71, 0x00, 0x0B, 0x17, 0x07,
+    0x17, 0x04, 0x00, 0x82, 0x6F, 0x68, 0x71, 0x00, 0x11, 0x1C, 0x09, 0x0C, 0x16, 0x1C, 0x16, 0x00,
+    0x84, 0x79, 0x66, 0x6E, 0x74, 0x71, 0x00, 0x40, 0xB3, 0x7F, 0x5E, 0x00, 0x3E, 0x19, 0x7D, 0x19,
+    0x8D, 0x19, 0xBF, 0x19, 0xDD, 0x19, 0x04, 0x1A, 0x11, 0x1A, 0x1E, 0x1A, 0x29, 0x1A, 0x68, 0x1A,
+    0x77, 0x1A, 0xD4, 0x1A, 0xE1, 0x1A, 0xF5, 0x1A, 0x00, 0x1B, 0x2F, 0x1B, 0x3C, 0x1B, 0x40, 0x08,
+    0x11, 0x20, 0x00, 0x4B, 0x19, 0x59, 0x19, 0x64, 0x19, 0x71, 0x19, 0x17, 0x10, 0x34, 0x12, 0x1A,
+    0x12, 0x00, 0x85, 0x6D, 0x74, 0x61, 0x64, 0x72, 0x00, 0x18, 0x07, 0x1A, 0x06, 0x00, 0x83, 0x69,
+    0x75, 0x61, 0x72, 0x00, 0x11, 0x08, 0x09, 0x09, 0x07, 0x00, 0x84, 0x6E, 0x65, 0x6D, 0x61, 0x72,
+    0x00, 0x0F, 0x0B, 0x12, 0x12, 0x00, 0x84, 0x6C, 0x68, 0x76, 0x61, 0x72, 0x00, 0x08, 0x04, 0x0E,
+    0x11, 0x16, 0x04, 0x04, 0x15, 0x00, 0x84, 0x61, 0x6B, 0x65, 0x62, 0x72, 0x00, 0x4D, 0x97, 0x19,
+    0x15, 0xA8, 0x19, 0x18, 0xB6, 0x19, 0x00, 0x12, 0x0B, 0x0C, 0x06, 0x0C, 0x0C, 0x0B, 0x00, 0x86,
+    0x69, 0x63, 0x68, 0x6F, 0x6A, 0x65, 0x72, 0x00, 0x0A, 0x1D, 0x11, 0x09, 0x07, 0x00, 0x85, 0x7A,
+    0x6E, 0x67, 0x72, 0x65, 0x72, 0x00, 0x15, 0x17, 0x12, 0x15, 0x00, 0x81, 0x72, 0x65, 0x00, 0x51,
+    0xC6, 0x19, 0x12, 0xD3, 0x19, 0x00, 0x1D, 0x07, 0x1D, 0x14, 0x00, 0x85, 0x64, 0x7A, 0x7A, 0x6E,
+    0x66, 0x72, 0x00, 0x15, 0x17, 0x0C, 0x15, 0x2C, 0x00, 0x81, 0x72, 0x66, 0x00, 0x47, 0xE7, 0x19,
+    0x11, 0xF0, 0x19, 0x15, 0xFA, 0x19, 0x00, 0x12, 0x1C, 0x0F, 0x12, 0x00, 0x81, 0x72, 0x68, 0x00,
+    0x1A, 0x11, 0x08, 0x08, 0x15, 0x00, 0x81, 0x72, 0x68, 0x00, 0x17, 0x14, 0x1B, 0x07, 0x18, 0x00,
+    0x81, 0x72, 0x68, 0x00, 0x12, 0x0C, 0x08, 0x0B, 0x15, 0x09, 0x0B, 0x11, 0x00, 0x81, 0x72, 0x69,
+    0x00, 0x07, 0x07, 0x0B, 0x10, 0x15, 0x08, 0x1A, 0x17, 0x00, 0x81, 0x72, 0x6A, 0x00, 0x13, 0x07,
+    0x17, 0x08, 0x16, 0x12, 0x00, 0x81, 0x72, 0x6B, 0x00, 0x40, 0x88, 0x48, 0x00, 0x00, 0x36, 0x1A,
+    0x43, 0x1A, 0x50, 0x1A, 0x5D, 0x1A, 0x17, 0x15, 0x1B, 0x08, 0x16, 0x00, 0x84, 0x74, 0x72, 0x64,
+    0x6C, 0x72, 0x00, 0x15, 0x08, 0x04, 0x17, 0x00, 0x85, 0x65, 0x61, 0x72, 0x68, 0x6C, 0x72, 0x00,
+    0x04, 0x08, 0x0C, 0x0B, 0x00, 0x85, 0x65, 0x69, 0x61, 0x6C, 0x6C, 0x72, 0x00, 0x0C, 0x11, 0x08,
+    0x04, 0x1A, 0x04, 0x00, 0x81, 0x72, 0x6C, 0x00, 0x11, 0x0B, 0x0C, 0x16, 0x05, 0x09, 0x18, 0x00,
+    0x84, 0x68, 0x69, 0x6E, 0x6D, 0x72, 0x00, 0x40, 0x81, 0x09, 0x00, 0x00, 0x84, 0x1A, 0x92, 0x1A,
+    0xA5, 0x1A, 0xC7, 0x1A, 0x04, 0x07, 0x05, 0x0A, 0x16, 0x00, 0x85, 0x64, 0x62, 0x61, 0x61, 0x6E,
+    0x72, 0x00, 0x14, 0x16, 0x12, 0x12, 0x08, 0x17, 0x1A, 0x00, 0x88, 0x65, 0x74, 0x6F, 0x6F, 0x73,
+    0x71, 0x68, 0x6E, 0x72, 0x00, 0x45, 0xAC, 0x1A, 0x11, 0xB5, 0x1A, 0x00, 0x17, 0x16, 0x04, 0x11,
+    0x00, 0x81, 0x72, 0x6E, 0x00, 0x0B, 0x12, 0x19, 0x17, 0x12, 0x0D, 0x00, 0x88, 0x74, 0x6F, 0x76,
+    0x6F, 0x68, 0x6E, 0x69, 0x6E, 0x72, 0x00, 0x16, 0x1B, 0x0C, 0x06, 0x16, 0x00, 0x84, 0x73, 0x78,
+    0x6C, 0x6E, 0x72, 0x00, 0x08, 0x18, 0x34, 0x12, 0x08, 0x07, 0x00, 0x84, 0x65, 0x75, 0x6F, 0x72,
+    0x00, 0x1D, 0x07, 0x17, 0x09, 0x0C, 0x12, 0x11, 0x0A, 0x00, 0x88, 0x6F, 0x6E, 0x69, 0x66, 0x74,
+    0x64, 0x7A, 0x72, 0x72, 0x00, 0x07, 0x17, 0x1C, 0x09, 0x1C, 0x10, 0x00, 0x81, 0x72, 0x73, 0x00,
+    0x4C, 0x07, 0x1B, 0x11, 0x24, 0x1B, 0x00, 0x45, 0x0E, 0x1B, 0x16, 0x18, 0x1B, 0x00, 0x15, 0x0B,
+    0x08, 0x00, 0x83, 0x69, 0x62, 0x74, 0x72, 0x00, 0x0B, 0x07, 0x16, 0x04, 0x08, 0x00, 0x83, 0x69,
+    0x73, 0x74, 0x72, 0x00, 0x07, 0x0D, 0x15, 0x14, 0x00, 0x83, 0x6E, 0x64, 0x74, 0x72, 0x00, 0x1B,
+    0x0A, 0x15, 0x09, 0x08, 0x19, 0x16, 0x00, 0x82, 0x75, 0x78, 0x72, 0x00, 0x0F, 0x07, 0x0C, 0x0C,
+    0x12, 0x18, 0x0C, 0x00, 0x83, 0x6C, 0x64, 0x77, 0x72, 0x00, 0x40, 0xBD, 0x61, 0x7E, 0x00, 0x6D,
+    0x1B, 0x94, 0x1B, 0xA8, 0x1B, 0xCD, 0x1B, 0xED, 0x1B, 0xFA, 0x1B, 0x1F, 0x1C, 0x5F, 0x1C, 0x97,
+    0x1C, 0xBC, 0x1C, 0xC7, 0x1C, 0xE8, 0x1C, 0xF4, 0x1C, 0x03, 0x1D, 0x22, 0x1D, 0x49, 0x74, 0x1B,
+    0x15, 0x86, 0x1B, 0x00, 0x17, 0x0B, 0x0B, 0x06, 0x07, 0x12, 0x0F, 0x00, 0x87, 0x63, 0x64, 0x68,
+    0x68, 0x74, 0x66, 0x61, 0x73, 0x00, 0x08, 0x1B, 0x0C, 0x1C, 0x0B, 0x15, 0x0B, 0x00, 0x83, 0x72,
+    0x65, 0x61, 0x73, 0x00, 0x04, 0x08, 0x18, 0x07, 0x0C, 0x18, 0x16, 0x0C, 0x00, 0x88, 0x75, 0x73,
+    0x69, 0x64, 0x75, 0x65, 0x61, 0x63, 0x73, 0x00, 0x48, 0xAF, 0x1B, 0x16, 0xBF, 0x1B, 0x00, 0x15,
+    0x1C, 0x15, 0x12, 0x0F, 0x06, 0x00, 0x86, 0x72, 0x6F, 0x79, 0x72, 0x65, 0x64, 0x73, 0x00, 0x1B,
+    0x15, 0x07, 0x07, 0x1C, 0x11, 0x00, 0x84, 0x78, 0x72, 0x73, 0x64, 0x73, 0x00, 0x4B, 0xD4, 0x1B,
+    0x16, 0xDF, 0x1B, 0x00, 0x15, 0x14, 0x1A, 0x12, 0x00, 0x83, 0x68, 0x72, 0x65, 0x73, 0x00, 0x12,
+    0x12, 0x1A, 0x06, 0x16, 0x15, 0x0A, 0x00, 0x83, 0x73, 0x6F, 0x65, 0x73, 0x00, 0x12, 0x11, 0x16,
+    0x10, 0x15, 0x00, 0x84, 0x6E, 0x73, 0x6F, 0x66, 0x73, 0x00, 0x48, 0x01, 0x1C, 0x0C, 0x0D, 0x1C,
+    0x00, 0x0B, 0x09, 0x11, 0x12, 0x00, 0x84, 0x68, 0x66, 0x65, 0x68, 0x73, 0x00, 0x07, 0x0D, 0x04,
+    0x16, 0x08, 0x04, 0x15, 0x00, 0x87, 0x73, 0x65, 0x61, 0x6A, 0x64, 0x69, 0x68, 0x73, 0x00, 0x40,
+    0x91, 0x00, 0x04, 0x00, 0x2C, 0x1C, 0x3B, 0x1C, 0x47, 0x1C, 0x53, 0x1C, 0x04, 0x16, 0x0B, 0x15,
+    0x09, 0x17, 0x00, 0x85, 0x73, 0x68, 0x61, 0x61, 0x69, 0x73, 0x00, 0x0B, 0x04, 0x10, 0x0F, 0x1A,
+    0x10, 0x00, 0x82, 0x69, 0x65, 0x73, 0x00, 0x1A, 0x0B, 0x1C, 0x12, 0x00, 0x84, 0x77, 0x68, 0x68,
+    0x69, 0x73, 0x00, 0x10, 0x12, 0x08, 0x04, 0x0C, 0x00, 0x83, 0x73, 0x6D, 0x69, 0x73, 0x00, 0x40,
+    0x48, 0x08, 0x02, 0x00, 0x6C, 0x1C, 0x76, 0x1C, 0x83, 0x1C, 0x8D, 0x1C, 0x16, 0x04, 0x04, 0x09,
+    0x0C, 0x00, 0x81, 0x73, 0x6E, 0x00, 0x09, 0x17, 0x17, 0x08, 0x08, 0x18, 0x17, 0x00, 0x82, 0x6E,
+    0x67, 0x73, 0x00, 0x09, 0x08, 0x16, 0x1C, 0x09, 0x00, 0x81, 0x73, 0x6E, 0x00, 0x06, 0x06, 0x1A,
+    0x0A, 0x12, 0x00, 0x81, 0x73, 0x6E, 0x00, 0x44, 0x9E, 0x1C, 0x06, 0xAB, 0x1C, 0x00, 0x07, 0x17,
+    0x17, 0x15, 0x0C, 0x00, 0x84, 0x64, 0x74, 0x61, 0x6F, 0x73, 0x00, 0x12, 0x16, 0x0B, 0x06, 0x09,
+    0x08, 0x00, 0x87, 0x63, 0x66, 0x68, 0x73, 0x6F, 0x63, 0x6F, 0x73, 0x00, 0x07, 0x0C, 0x16, 0x07,
+    0x16, 0x00, 0x82, 0x72, 0x64, 0x73, 0x00, 0x4A, 0xCE, 0x1C, 0x1C, 0xD9, 0x1C, 0x00, 0x06, 0x1A,
+    0x0C, 0x16, 0x00, 0x83, 0x67, 0x63, 0x73, 0x73, 0x00, 0x08, 0x1D, 0x04, 0x1A, 0x15, 0x00, 0x86,
+    0x61, 0x77, 0x7A, 0x65, 0x79, 0x73, 0x73, 0x00, 0x1A, 0x0F, 0x19, 0x11, 0x12, 0x00, 0x83, 0x77,
+    0x6C, 0x74, 0x73, 0x00, 0x07, 0x10, 0x0C, 0x07, 0x15, 0x1C, 0x00, 0x85, 0x69, 0x64, 0x6D, 0x64,
+    0x75, 0x73, 0x00, 0x44, 0x0A, 0x1D, 0x18, 0x15, 0x1D, 0x00, 0x1A, 0x0A, 0x0C, 0x08, 0x05, 0x00,
+    0x82, 0x76, 0x61, 0x73, 0x00, 0x0E, 0x0C, 0x12, 0x17, 0x1C, 0x00, 0x84, 0x6B, 0x69, 0x75, 0x76,
+    0x73, 0x00, 0x05, 0x13, 0x1C, 0x0B, 0x04, 0x0A, 0x06, 0x2C, 0x00, 0x82, 0x77, 0x62, 0x73, 0x00,
+    0x40, 0xFF, 0xFB, 0x42, 0x03, 0x5B, 0x1D, 0x66, 0x1D, 0x75, 0x1D, 0x99, 0x1D, 0xBC, 0x1D, 0xC9,
+    0x1D, 0xF9, 0x1D, 0x1D, 0x1E, 0x2B, 0x1E, 0x5C, 0x1E, 0x79, 0x1E, 0x88, 0x1E, 0xB1, 0x1E, 0xBF,
+    0x1E, 0xD1, 0x1E, 0xDE, 0x1E, 0xFD, 0x1E, 0x0A, 0x1F, 0x1B, 0x1F, 0x11, 0x17, 0x1C, 0x07, 0x0B,
+    0x00, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x07, 0x1C, 0x12, 0x18, 0x13, 0x18, 0x00, 0x85, 0x6F, 0x75,
+    0x79, 0x64, 0x62, 0x74, 0x00, 0x51, 0x7C, 0x1D, 0x1C, 0x8C, 0x1D, 0x00, 0x11, 0x0D, 0x07, 0x05,
+    0x16, 0x12, 0x00, 0x86, 0x64, 0x62, 0x6A, 0x6E, 0x6E, 0x63, 0x74, 0x00, 0x0B, 0x08, 0x0B, 0x0B,
+    0x16, 0x0A, 0x00, 0x83, 0x79, 0x68, 0x63, 0x74, 0x00, 0x46, 0xA0, 0x1D, 0x15, 0xAF, 0x1D, 0x00,
+    0x10, 0x11, 0x07, 0x0E, 0x0F, 0x00, 0x86, 0x64, 0x6B, 0x6E, 0x6D, 0x63, 0x64, 0x74, 0x00, 0x11,
+    0x11, 0x07, 0x16, 0x00, 0x85, 0x6E, 0x64, 0x6E, 0x72, 0x64, 0x74, 0x00, 0x07, 0x0C, 0x04, 0x0A,
+    0x1A, 0x16, 0x00, 0x83, 0x64, 0x69, 0x65, 0x74, 0x00, 0x44, 0xD3, 0x1D, 0x16, 0xDD, 0x1D, 0x17,
+    0xEE, 0x1D, 0x00, 0x18, 0x15, 0x16, 0x0C, 0x09, 0x00, 0x81, 0x74, 0x66, 0x00, 0x11, 0x14, 0x12,
+    0x11, 0x0B, 0x0A, 0x04, 0x00, 0x86, 0x6F, 0x6E, 0x71, 0x6E, 0x73, 0x66, 0x74, 0x00, 0x0B, 0x10,
+    0x15, 0x05, 0x00, 0x83, 0x74, 0x68, 0x66, 0x74, 0x00, 0x45, 0x00, 0x1E, 0x06, 0x12, 0x1E, 0x00,
+    0x0B, 0x0F, 0x14, 0x0C, 0x12, 0x1A, 0x1B, 0x00, 0x87, 0x69, 0x6F, 0x71, 0x6C, 0x68, 0x62, 0x67,
+    0x74, 0x00, 0x07, 0x04, 0x15, 0x10, 0x0C, 0x04, 0x00, 0x81, 0x74, 0x67, 0x00, 0x07, 0x10, 0x0D,
+    0x0B, 0x0C, 0x00, 0x85, 0x6A, 0x68, 0x6D, 0x64, 0x68, 0x74, 0x00, 0x4B, 0x35, 0x1E, 0x16, 0x42,
+    0x1E, 0x1C, 0x50, 0x1E, 0x00, 0x06, 0x06, 0x12, 0x0B, 0x00, 0x85, 0x63, 0x6F, 0x63, 0x68, 0x69,
+    0x74, 0x00, 0x17, 0x06, 0x1C, 0x11, 0x16, 0x08, 0x0F, 0x2C, 0x00, 0x82, 0x69, 0x73, 0x74, 0x00,
+    0x0B, 0x04, 0x07, 0x15, 0x12, 0x00, 0x83, 0x79, 0x68, 0x69, 0x74, 0x00, 0x4A, 0x63, 0x1E, 0x0B,
+    0x6D, 0x1E, 0x00, 0x0C, 0x0F, 0x08, 0x11, 0x00, 0x82, 0x6A, 0x67, 0x74, 0x00, 0x04, 0x0C, 0x0C,
+    0x0B, 0x11, 0x0B, 0x12, 0x00, 0x81, 0x74, 0x6A, 0x00, 0x0B, 0x09, 0x10, 0x34, 0x04, 0x16, 0x09,
+    0x00, 0x85, 0x6D, 0x68, 0x66, 0x6C, 0x74, 0x00, 0x55, 0x8F, 0x1E, 0x17, 0xA2, 0x1E, 0x00, 0x04,
+    0x17, 0x08, 0x04, 0x17, 0x12, 0x1A, 0x00, 0x88, 0x74, 0x6F, 0x61, 0x65, 0x74, 0x61, 0x72, 0x6D,
+    0x74, 0x00, 0x16, 0x0C, 0x07, 0x16, 0x0D, 0x00, 0x86, 0x64, 0x73, 0x69, 0x73, 0x74, 0x6D, 0x74,
+    0x00, 0x17, 0x18, 0x04, 0x0C, 0x1A, 0x00, 0x85, 0x61, 0x69, 0x75, 0x74, 0x6E, 0x74, 0x00, 0x08,
+    0x14, 0x07, 0x0C, 0x15, 0x09, 0x06, 0x00, 0x87, 0x72, 0x66, 0x69, 0x64, 0x71, 0x65, 0x6F, 0x74,
+    0x00, 0x1D, 0x17, 0x12, 0x19, 0x0A, 0x15, 0x12, 0x00, 0x82, 0x70, 0x7A, 0x74, 0x00, 0x4B, 0xE5,
+    0x1E, 0x1C, 0xF1, 0x1E, 0x00, 0x10, 0x04, 0x0E, 0x1B, 0x1C, 0x07, 0x00, 0x82, 0x72, 0x68, 0x74,
+    0x00, 0x0C, 0x08, 0x0A, 0x07, 0x00, 0x84, 0x69, 0x65, 0x79, 0x72, 0x74, 0x00, 0x0F, 0x0E, 0x34,
+    0x16, 0x18, 0x15, 0x00, 0x84, 0x6B, 0x6C, 0x74, 0x77, 0x00, 0x17, 0x17, 0x15, 0x0E, 0x16, 0x07,
+    0x12, 0x07, 0x00, 0x85, 0x72, 0x6B, 0x74, 0x74, 0x79, 0x74, 0x00, 0x11, 0x04, 0x18, 0x11, 0x10,
+    0x1C, 0x00, 0x81, 0x74, 0x7A, 0x00, 0x40, 0xB7, 0xA9, 0x0C, 0x00, 0x43, 0x1F, 0x51, 0x1F, 0x5C,
+    0x1F, 0x6F, 0x1F, 0xA7, 0x1F, 0xB6, 0x1F, 0xC5, 0x1F, 0xF7, 0x1F, 0x15, 0x20, 0x1F, 0x20, 0x2D,
+    0x20, 0x38, 0x20, 0x06, 0x10, 0x1A, 0x0C, 0x0C, 0x0C, 0x00, 0x84, 0x6D, 0x77, 0x63, 0x61, 0x75,
+    0x00, 0x0A, 0x0B, 0x0C, 0x18, 0x04, 0x12, 0x00, 0x81, 0x75, 0x62, 0x00, 0x16, 0x15, 0x07, 0x04,
+    0x0F, 0x0E, 0x1C, 0x0B, 0x00, 0x87, 0x6C, 0x6B, 0x61, 0x64, 0x72, 0x73, 0x63, 0x75, 0x00, 0x53,
+    0x76, 0x1F, 0x1C, 0x86, 0x1F, 0x00, 0x1C, 0x0C, 0x15, 0x10, 0x10, 0x07, 0x00, 0x86, 0x72, 0x6D,
+    0x69, 0x79, 0x70, 0x65, 0x75, 0x00, 0x56, 0x8D, 0x1F, 0x18, 0x99, 0x1F, 0x00, 0x07, 0x0F, 0x18,
+    0x1B, 0x07, 0x0C, 0x00, 0x82, 0x65, 0x79, 0x75, 0x00, 0x16, 0x07, 0x09, 0x15, 0x10, 0x2C, 0x00,
+    0x84, 0x75, 0x73, 0x79, 0x65, 0x75, 0x00, 0x1D, 0x0C, 0x0C, 0x0D, 0x12, 0x04, 0x00, 0x85, 0x69,
+    0x6A, 0x69, 0x7A, 0x66, 0x75, 0x00, 0x11, 0x12, 0x05, 0x12, 0x0C, 0x07, 0x0B, 0x15, 0x00, 0x83,
+    0x6E, 0x6F, 0x68, 0x75, 0x00, 0x44, 0xCF, 0x1F, 0x07, 0xDC, 0x1F, 0x16, 0xE6, 0x1F, 0x00, 0x16,
+    0x0B, 0x07, 0x16, 0x09, 0x17, 0x19, 0x00, 0x82, 0x69, 0x61, 0x75, 0x00, 0x09, 0x16, 0x0B, 0x15,
+    0x00, 0x82, 0x69, 0x64, 0x75, 0x00, 0x04, 0x0E, 0x1C, 0x09, 0x18, 0x0C, 0x12, 0x00, 0x86, 0x79,
+    0x66, 0x6B, 0x61, 0x73, 0x69, 0x75, 0x00, 0x46, 0xFE, 0x1F, 0x0C, 0x08, 0x20, 0x00, 0x16, 0x0B,
+    0x04, 0x07, 0x06, 0x00, 0x81, 0x75, 0x6C, 0x00, 0x12, 0x11, 0x16, 0x04, 0x00, 0x85, 0x6E, 0x73,
+    0x6F, 0x69, 0x6C, 0x75, 0x00, 0x04, 0x08, 0x07, 0x17, 0x1D, 0x00, 0x81, 0x75, 0x6E, 0x00, 0x04,
+    0x11, 0x08, 0x07, 0x18, 0x04, 0x18, 0x09, 0x00, 0x82, 0x70, 0x61, 0x75, 0x00, 0x15, 0x0B, 0x05,
+    0x16, 0x15, 0x00, 0x82, 0x73, 0x72, 0x75, 0x00, 0x0A, 0x17, 0x15, 0x0A, 0x07, 0x10, 0x00, 0x85,
+    0x72, 0x67, 0x74, 0x67, 0x74, 0x75, 0x00, 0x40, 0x11, 0x09, 0x02, 0x00, 0x56, 0x20, 0x74, 0x20,
+    0x82, 0x20, 0x8E, 0x20, 0x9D, 0x20, 0x56, 0x5D, 0x20, 0x17, 0x69, 0x20, 0x00, 0x0B, 0x05, 0x07,
+    0x11, 0x07, 0x07, 0x00, 0x82, 0x61, 0x73, 0x76, 0x00, 0x07, 0x12, 0x05, 0x0B, 0x00, 0x83, 0x74,
+    0x64, 0x61, 0x76, 0x00, 0x0F, 0x17, 0x10, 0x08, 0x11, 0x15, 0x16, 0x12, 0x00, 0x82, 0x65, 0x6C,
+    0x76, 0x00, 0x0B, 0x15, 0x04, 0x05, 0x18, 0x00, 0x83, 0x68, 0x72, 0x69, 0x76, 0x00, 0x04, 0x0B,
+    0x15, 0x11, 0x17, 0x06, 0x04, 0x1A, 0x00, 0x83, 0x61, 0x68, 0x6C, 0x76, 0x00, 0x4E, 0xA7, 0x20,
+    0x13, 0xB3, 0x20, 0x18, 0xBD, 0x20, 0x00, 0x16, 0x34, 0x1A, 0x09, 0x16, 0x00, 0x84, 0x6B, 0x73,
+    0x72, 0x76, 0x00, 0x0F, 0x10, 0x0A, 0x16, 0x00, 0x82, 0x72, 0x70, 0x76, 0x00, 0x0C, 0x15, 0x12,
+    0x0B, 0x15, 0x00, 0x84, 0x69, 0x72, 0x75, 0x72, 0x76, 0x00, 0x40, 0x09, 0xA8, 0x0A, 0x03, 0xE1,
+    0x20, 0x11, 0x21, 0x34, 0x21, 0x48, 0x21, 0x57, 0x21, 0x67, 0x21, 0x88, 0x21, 0xA9, 0x21, 0xC6,
+    0x21, 0x48, 0xE8, 0x20, 0x1B, 0x06, 0x21, 0x00, 0x47, 0xEF, 0x20, 0x16, 0xFE, 0x20, 0x00, 0x1B,
+    0x1C, 0x04, 0x0C, 0x09, 0x00, 0x86, 0x79, 0x61, 0x78, 0x64, 0x65, 0x61, 0x77, 0x00, 0x07, 0x0E,
+    0x15, 0x00, 0x81, 0x77, 0x61, 0x00, 0x17, 0x07, 0x10, 0x15, 0x19, 0x10, 0x00, 0x81, 0x77, 0x61,
+    0x00, 0x46, 0x18, 0x21, 0x0F, 0x27, 0x21, 0x00, 0x0F, 0x12, 0x17, 0x12, 0x08, 0x00, 0x86, 0x74,
+    0x6F, 0x6F, 0x6C, 0x63, 0x64, 0x77, 0x00, 0x1A, 0x0C, 0x1A, 0x19, 0x08, 0x00, 0x84, 0x77, 0x69,
+    0x6C, 0x64, 0x77, 0x00, 0x16, 0x18, 0x06, 0x12, 0x19, 0x10, 0x07, 0x06, 0x00, 0x88, 0x6D, 0x64,
+    0x76, 0x6F, 0x63, 0x75, 0x73, 0x6C, 0x77, 0x00, 0x16, 0x0B, 0x06, 0x16, 0x0C, 0x0C, 0x00, 0x85,
+    0x63, 0x73, 0x68, 0x73, 0x6E, 0x77, 0x00, 0x12, 0x07, 0x1B, 0x11, 0x08, 0x0C, 0x11, 0x2C, 0x00,
+    0x84, 0x64, 0x78, 0x6F, 0x70, 0x77, 0x00, 0x4B, 0x6E, 0x21, 0x0C, 0x79, 0x21, 0x00, 0x0E, 0x0B,
+    0x19, 0x04, 0x07, 0x17, 0x00, 0x81, 0x77, 0x72, 0x00, 0x0D, 0x0B, 0x17, 0x14, 0x07, 0x00, 0x86,
+    0x74, 0x71, 0x68, 0x6A, 0x69, 0x72, 0x77, 0x00, 0x44, 0x8F, 0x21, 0x1A, 0x9F, 0x21, 0x00, 0x0B,
+    0x08, 0x05, 0x06, 0x1C, 0x16, 0x00, 0x86, 0x62, 0x63, 0x65, 0x68, 0x61, 0x74, 0x77, 0x00, 0x11,
+    0x17, 0x0A, 0x06, 0x00, 0x82, 0x74, 0x77, 0x77, 0x00, 0x4B, 0xB0, 0x21, 0x12, 0xB9, 0x21, 0x00,
+    0x10, 0x12, 0x04, 0x04, 0x00, 0x81, 0x77, 0x79, 0x00, 0x15, 0x07, 0x09, 0x07, 0x17, 0x07, 0x04,
+    0x00, 0x82, 0x79, 0x6F, 0x77, 0x00, 0x0C, 0x0F, 0x0B, 0x04, 0x12, 0x18, 0x00, 0x82, 0x7A, 0x69,
+    0x77, 0x00, 0x40, 0x49, 0x48, 0x20, 0x00, 0xE3, 0x21, 0xEE, 0x21, 0xFA, 0x21, 0x06, 0x22, 0x16,
+    0x22, 0x23, 0x22, 0x14, 0x0F, 0x11, 0x1D, 0x16, 0x00, 0x82, 0x61, 0x71, 0x78, 0x00, 0x0A, 0x16,
+    0x0B, 0x0A, 0x1A, 0x11, 0x00, 0x82, 0x64, 0x67, 0x78, 0x00, 0x17, 0x15, 0x16, 0x07, 0x07, 0x09,
+    0x0A, 0x00, 0x81, 0x78, 0x67, 0x00, 0x0D, 0x16, 0x0C, 0x04, 0x10, 0x0C, 0x0B, 0x00, 0x85, 0x69,
+    0x61, 0x73, 0x6A, 0x6C, 0x78, 0x00, 0x08, 0x07, 0x06, 0x11, 0x0C, 0x00, 0x84, 0x64, 0x63, 0x65,
+    0x6F, 0x78, 0x00, 0x15, 0x10, 0x0B, 0x1A, 0x12, 0x0F, 0x13, 0x07, 0x00, 0x85, 0x68, 0x77, 0x6D,
+    0x72, 0x76, 0x78, 0x00, 0x40, 0x09, 0x0A, 0xCC, 0x01, 0x4B, 0x22, 0x6C, 0x22, 0x80, 0x22, 0x8F,
+    0x22, 0x9B, 0x22, 0xBF, 0x22, 0xCE, 0x22, 0xDC, 0x22, 0xEC, 0x22, 0x48, 0x52, 0x22, 0x11, 0x5D,
+    0x22, 0x00, 0x04, 0x1C, 0x0F, 0x0C, 0x18, 0x00, 0x82, 0x61, 0x65, 0x79, 0x00, 0x08, 0x0C, 0x18,
+    0x06, 0x0C, 0x08, 0x0B, 0x2C, 0x00, 0x83, 0x6E, 0x65, 0x61, 0x79, 0x00, 0x08, 0x15, 0x0B, 0x19,
+    0x04, 0x0C, 0x1B, 0x12, 0x00, 0x88, 0x69, 0x78, 0x61, 0x76, 0x68, 0x72, 0x65, 0x64, 0x79, 0x00,
+    0x17, 0x0B, 0x0C, 0x34, 0x04, 0x12, 0x15, 0x00, 0x85, 0x69, 0x68, 0x6A, 0x74, 0x79, 0x00, 0x17,
+    0x0C, 0x17, 0x15, 0x0B, 0x1C, 0x00, 0x82, 0x6C, 0x74, 0x79, 0x00, 0x4C, 0xA2, 0x22, 0x11, 0xB4,
+    0x22, 0x00, 0x0A, 0x04, 0x12, 0x11, 0x16, 0x12, 0x04, 0x00, 0x87, 0x6E, 0x73, 0x6F, 0x61, 0x67,
+    0x69, 0x73, 0x79, 0x00, 0x1A, 0x12, 0x04, 0x0B, 0x00, 0x83, 0x6E, 0x77, 0x73, 0x79, 0x00, 0x0E,
+    0x0B, 0x18, 0x1C, 0x0A, 0x11, 0x00, 0x85, 0x75, 0x79, 0x68, 0x6B, 0x74, 0x79, 0x00, 0x0C, 0x1D,
+    0x0E, 0x0B, 0x16, 0x09, 0x00, 0x84, 0x7A, 0x6B, 0x69, 0x77, 0x79, 0x00, 0x11, 0x0C, 0x04, 0x11,
+    0x10, 0x0B, 0x04, 0x00, 0x85, 0x61, 0x6E, 0x69, 0x6E, 0x78, 0x79, 0x00, 0x15, 0x17, 0x0F, 0x18,
+    0x09, 0x00, 0x85, 0x6C, 0x75, 0x74, 0x72, 0x79, 0x79, 0x00, 0x52, 0x04, 0x23, 0x15, 0x12, 0x23,
+    0x18, 0x20, 0x23, 0x00, 0x0C, 0x15, 0x16, 0x0C, 0x04, 0x00, 0x85, 0x73, 0x69, 0x72, 0x69, 0x6F,
+    0x7A, 0x00, 0x10, 0x11, 0x1C, 0x04, 0x15, 0x04, 0x00, 0x84, 0x6E, 0x79, 0x6D, 0x72, 0x7A, 0x00,
+    0x1A, 0x18, 0x0B, 0x19, 0x10, 0x00, 0x84, 0x75, 0x68, 0x77, 0x75, 0x7A, 0x00
+};
@@ -0,0 +1,614 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "keycode.h"
+#include "test_common.hpp"
+
+struct AutocorrectEntry {
+    const char *typo;
+    const char *correction;
+};
+
+// The dictionary autocorrect_data.h was generated from
+static const AutocorrectEntry dictionary[] = {
+    {"earnivcra", "earnivcar"},
+    {"chnrsdhpye", "chnrsdhype"},
+    {"ochqtrgwai", "ochtqrgwai"},
+    {"omydcnpr:", "omydcnrp"},
+    {"oxiavhredy", "oixavhredy"},
+    {"haomnlawo", "hamonlawo"},
+    {"hdytnat", "hdytant"},
+    {"edgavijhh", "edgavjihh"},
+    {"rmsnofs", "rmnsofs"},
+    {"nswriaj", "nswiraj"},
+    {"neligjt", "nelijgt"},
+    {"hieallr", "heiallr"},
+    {"fiayxdeaw", "fiyaxdeaw"},
+    {"iarpsloul", "iarplsoul"},
+    {"orgvotzpt", "orgvotpzt"},
+    {"lodchhtfas", "locdhhtfas"},
+    {"frbterdsdo:", "frtberdsdo"},
+    {"rhdiobonhu", "rhdiobnohu"},
+    {"cneqgeaee", "cneqegaee"},
+    {"naofoexn", "naofoenx"},
+    {"rblhnnanlc", "rbhlnnanlc"},
+    {"ogwccrns", "ogwccrsn"},
+    {"ysntsdorhc", "ysntsdohrc"},
+    {"twermhddjr", "twermhddrj"},
+    {"ecsafuadge", "ecsfauadge"},
+    {"ubarhiv", "ubahriv"},
+    {"irttdaos", "irtdtaos"},
+    {"fanoweoak", "fanoweaok"},
+    {"seontmhn", "seontmnh"},
+    {"cdmvocuslw", "cmdvocuslw"},
+    {"xneumaode", "xneumaoed"},
+    {"ytoikuvs", "ytokiuvs"},
+    {"xhnjitawj", "xhnijtawj"},
+    {"dxnstlb", "dxsntlb"},
+    {"sdsidrs", "sdsirds"},
+    {"dnhqtygdnd", "dnhqtgydnd"},
+    {"tdgmoucde", "tdgmoudce"},
+    {"ikyrhsn", "ikyrhns"},
+    {"yihffhf", "yhiffhf"},
+    {"dfnzgrer", "dfzngrer"},
+    {"hrayatmkln", "hrayamtkln"},
+    {"tyuthadiff", "tyuthdaiff"},
+    {"hykladrscu", "hylkadrscu"},
+    {"tso'sjad", "tssojad"},
+    {":nlynslobh", "nlnyslobh"},
+    {"dluiytuaed", "duliytuaed"},
+    {":heicuienay", "heicuineay"},
+    {"easdhsitr", "easdhistr"},
+    {"iuefhqeymi", "iufehqeymi"},
+    {"tersdrdgn", "terdsrdgn"},
+    {"fgd'wstd", "fdgwstd"},
+    {"aehntnshkp", "ahentnshkp"},
+    {"nleishi", "nlieshi"},
+    {"dxnaereo", "dxanereo"},
+    {"otdsnpaefn", "otdsnpafen"},
+    {"hocchit", "hcochit"},
+    {"ernfgcpg", "ernfcgpg"},
+    {"egmmpdod", "emgmpdod"},
+    {"tndtrlih", "tntdrlih"},
+    {"aegolsse", "ageolsse"},
+    {"oaoeboh:", "ooaeboh"},
+    {"uysyknhlqh", "uyskynhlqh"},
+    {"onfhehs", "onhfehs"},
+    {"imrcjagti", "irmcjagti"},
+    {"aqqfgne", "aqfqgne"},
+    {"ybaevhf", "yabevhf"},
+    {"rllhantapn", "rllahntapn"},
+    {"cauftho", "cuaftho"},
+    {"uoahlizw", "uoahlziw"},
+    {"ndsewqufpo", "ndeswqufpo"},
+    {"dnelhfdneo:", "dnelhfndeo"},
+    {"mkplnbhyua", "mkplnbyhua"},
+    {"afadhajg", "afahdajg"},
+    {"elxeiol", "elexiol"},
+    {"hiicihojer", "hiiichojer"},
+    {"tenpyxte", "tnepyxte"},
+    {"tsraxegmsn", "tsraxemgsn"},
+    {"nwghsgdx", "nwghsdgx"},
+    {"nhfrheioir", "nhfrheiori"},
+    {"ielrfoahhn", "ielfroahhn"},
+    {"aimradcgt", "aimradctg"},
+    {"fexxhrd", "fexxrhd"},
+    {"aseehsoh", "aseehosh"},
+    {"renolthae", "renolhtae"},
+    {"cczwdid", "cczwddi"},
+    {"iaeomsis", "iaeosmis"},
+    {"scixslnr", "scisxlnr"},
+    {"nastbinr", "nastbirn"},
+    {"oiufykasiu", "oiuyfkasiu"},
+    {"ohnhiiahjt", "ohnhiiahtj"},
+    {"nhetarzhda:", "nheatrzhda"},
+    {"oitdrdl", "oidtrdl"},
+    {"jotvohninr", "jtovohninr"},
+    {":fwrsdvlnn", "frwsdvlnn"},
+    {"wthotdn", "wthtodn"},
+    {"ihaktcosl", "ihaktcsol"},
+    {"vtfsdhsaiu", "vtfsdhsiau"},
+    {"oeaomdn", "oeamodn"},
+    {"dspfajha", "dspafjha"},
+    {"qzdznfr", "qdzznfr"},
+    {"nofotyuysa", "nofotyuyas"},
+    {"ntichdcmkn", "nitchdcmkn"},
+    {"onvlwts", "onvwlts"},
+    {"grscwooses", "grscwosoes"},
+    {"dtehrrhf:", "dtehrhrf"},
+    {"asnoilu", "ansoilu"},
+    {"sycbehatw", "sybcehatw"},
+    {"euowzhmn", "euozwhmn"},
+    {":bnygodd", "byngodd"},
+    {"hauwaloiie", "hauwaloiei"},
+    {"trstnil", "tsrtnil"},
+    {"aaomhyw", "aaomhwy"},
+    {"ursraymtl", "urrsaymtl"},
+    {"jsdistmt", "jdsistmt"},
+    {"nrsirbg", "nrsribg"},
+    {"rohmsikel", "rhomsikel"},
+    {"aojiizfu", "aoijizfu"},
+    {"ooehwtr:", "ooehtwr"},
+    {"agxtqdc", "agtxqdc"},
+    {"sgllcnrzai", "sglclnrzai"},
+    {"dqcsniei", "dqscniei"},
+    {"ddisosmoe", "didsosmoe"},
+    {"amnthhm", "amnhthm"},
+    {"eistrdh", "eistrhd"},
+    {"gfddsrtgx", "gfddsrtxg"},
+    {"ymnuanzt", "ymnuantz"},
+    {"isjcoqftti:", "isjcoqftit"},
+    {"raesajdihs", "raseajdihs"},
+    {"isuidueacs", "iusidueacs"},
+    {"osrnemtlev", "osrnemtelv"},
+    {"ebs'vhqiugi", "ebsvhiqugi"},
+    {"uetudyeo", "ueutdyeo"},
+    {"irsedmth", "irsedmht"},
+    {"qrjdntr", "qrjndtr"},
+    {"tcyatogoo", "tycatogoo"},
+    {"iiiwmcau", "iiimwcau"},
+    {"ddndbhsav", "ddndbhasv"},
+    {"inpsdeym", "inpsdyem"},
+    {"rdtfsalae", "rdtfslaae"},
+    {"ddtzwfhdmc", "ddtwzfhdmc"},
+    {":rwsurtd", "rswurtd"},
+    {"lrrcarsng", "lrrcrasng"},
+    {"yrgsihzak", "yrgishzak"},
+    {"bokbtyin", "bokbtyni"},
+    {"uaginyh", "uagiynh"},
+    {"hhytrmd", "hhtyrmd"},
+    {"sobagjing", "sobagjnig"},
+    {"dyiijdn", "dyijidn"},
+    {"dwsmegbdp", "dwsmgebdp"},
+    {":nienxdopw", "niendxopw"},
+    {"oeobdux:", "oeobdxu"},
+    {"dyxkamhrt", "dyxkamrht"},
+    {"swuydsia", "swuydisa"},
+    {"xwoiqlhbgt", "xwioqlhbgt"},
+    {"uyfgoiante", "uyfgioante"},
+    {"dlshsto", "dlshtso"},
+    {"raasnkaebr", "raasnakebr"},
+    {"owqrhes", "owqhres"},
+    {"ahnvomrrvl", "ahnvomrvrl"},
+    {"atdthoq", "atdtohq"},
+    {"awsimagrh", "awsiamgrh"},
+    {"eanwortoba", "eawnortoba"},
+    {"riprltb", "rirpltb"},
+    {"mdgrtgtu", "mdrgtgtu"},
+    {"wkshsre", "wskhsre"},
+    {"mougoinnc", "mougoninc"},
+    {"cbdbgzsm:", "cbbdgzsm"},
+    {"iqirolwm", "iiqrolwm"},
+    {"owaiihl", "owaihil"},
+    {"rrlothrlc", "rrlotrhlc"},
+    {"aonagwa", "aoangwa"},
+    {"dmmriypeu", "dmrmiypeu"},
+    {"dldhscj", "dldhcsj"},
+    {"ztdeanu", "ztdeaun"},
+    {"ehnigtngen", "ehnigtgnen"},
+    {"iekkiqexa:", "iekkiqeax"},
+    {"gshhehyct", "gshheyhct"},
+    {"urzvrneee", "uzrvrneee"},
+    {"brmhtft", "brmthft"},
+    {"hhnglraytf:", "hhnglryatf"},
+    {"ngaatlobn", "ngaatlbon"},
+    {"sysifyntq", "sysiyfntq"},
+    {"iyntygn", "iynytgn"},
+    {"ndlxnib", "ndlxinb"},
+    {"tfrhsaais", "tfrshaais"},
+    {"dupnhtbco", "dunphtbco"},
+    {"sihuodf", "sihuofd"},
+    {"savnyazw:", "svanyazw"},
+    {"adrihqyno", "adrihqyon"},
+    {"nheftnptd", "nhfetnptd"},
+    {"xtluredaeh", "xtlruedaeh"},
+    {":dwdhncedrd", "dwdhnceddr"},
+    {"acdwefceb", "acdwfeceb"},
+    {"sysynraoaj", "sysnyraoaj"},
+    {"dhehadaei", "dhehadaie"},
+    {"rwazeyss", "rawzeyss"},
+    {"myfytdsr", "myfytdrs"},
+    {"ttgbzzoei", "ttgbzozei"},
+    {"vxaaitf", "vaxaitf"},
+    {"fshkziwy", "fshzkiwy"},
+    {":lesnyctsit", "lesnyctist"},
+    {"aoyhrstden", "aoyhrtsden"},
+    {"gde'hiai", "gdeihai"},
+    {"nnoncocesl", "nnoncocsel"},
+    {"symiosaf", "symisoaf"},
+    {"wactnrhalv", "wactnrahlv"},
+    {"oyhwhis", "oywhhis"},
+    {"svefrgxur", "svefrguxr"},
+    {":rnztfgjaa", "rzntfgjaa"},
+    {"haownsy", "haonwsy"},
+    {"vraesshng", "varesshng"},
+    {"fnyyakoj", "fnyaykoj"},
+    {"taearrsae", "teaarrsae"},
+    {"aieelzmnj", "aeielzmnj"},
+    {":mrfdsuyeu", "mrfdusyeu"},
+    {"sznlqax", "sznlaqx"},
+    {"siepdih", "siedpih"},
+    {"hdordsien", "hdordsein"},
+    {"oetzomih", "oetzmoih"},
+    {"kdiuehgse", "kdiuehsge"},
+    {"caklssno", "caklsnso"},
+    {"beigwavs", "beigwvas"},
+    {"dpgewrb", "dgpewrb"},
+    {"dqthjirw", "dtqhjirw"},
+    {"ufdjqngceo", "ufdjqngcoe"},
+    {"ncnwreiesg", "ncnwrieesg"},
+    {"efchsocos", "ecfhsocos"},
+    {"sqhedfog", "sqhefdog"},
+    {"erahiaam", "erhaiaam"},
+    {"ljetiom", "lejtiom"},
+    {"hdvrecfn", "hdvrecnf"},
+    {"mvhuwuz", "mvuhwuz"},
+    {":ritrofr", "ritrorf"},
+    {"cloryreds", "clroyreds"},
+    {"rswdrogami", "rswdrogmai"},
+    {"idxuldsyeu", "idxuldseyu"},
+    {"adtkero", "adtkeor"},
+    {"ineipxowsf", "inepixowsf"},
+    {"hucsrca", "hucscra"},
+    {"kogatjh", "koagtjh"},
+    {"rsninduanf", "rsnindunaf"},
+    {"nlokrnndh", "nolkrnndh"},
+    {"ypweeya", "ypweyea"},
+    {":fwcsrredj", "fwcsrrdej"},
+    {"zthtnylmsg", "zhttnylmsg"},
+    {"taerhlr", "tearhlr"},
+    {"vedhzwd", "vehdzwd"},
+    {"rtndesiooo", "rtdnesiooo"},
+    {"tderusr:", "tdeursr"},
+    {"dodskrttyt", "dodsrkttyt"},
+    {"aat'igpmawp", "aatipgmawp"},
+    {"dafsddmn", "dfasddmn"},
+    {"asnatilord:", "asantilord"},
+    {"mjhruabrid", "mjhruabird"},
+    {"ngyuhkty", "nguyhkty"},
+    {":dtecdtrd", "dtcedtrd"},
+    {"ozaecehc", "ozaeechc"},
+    {":jmororrm", "jmorormr"},
+    {"sgbdaanr", "sgdbaanr"},
+    {"mrwogre", "mwrogre"},
+    {"gnoiftdzrr", "goniftdzrr"},
+    {"puirjtfo", "puirjtof"},
+    {"lrstjgp", "lsrtjgp"},
+    {"fuaudenapu", "fuaudenpau"},
+    {"ipacntn", "ipcantn"},
+    {"sojermna", "soejrmna"},
+    {"uilyaeay", "uilyaaey"},
+    {":cgahypbws", "cgahypwbs"},
+    {"eeaoslnp", "eaeoslnp"},
+    {"wtmgsdc", "wtmgdsc"},
+    {"rghlqgihe", "rghlqighe"},
+    {"xaoeduqd", "xaeoduqd"},
+    {"rjkvxork", "rjkvxokr"},
+    {"hlrrwhngnh", "hlrwrhngnh"},
+    {"wltrsdn", "wlrtsdn"},
+    {"ufbsihnmr", "ufbshinmr"},
+    {"dre'oiiehnn", "dreoiihenn"},
+    {"rotruer", "rotrure"},
+    {"heahldhhd", "heahlhdhd"},
+    {"mwlmaheis", "mwlmahies"},
+    {"amibooroa", "amiborooa"},
+    {"dgeiyrt", "dgieyrt"},
+    {"ahitwan", "ahitawn"},
+    {"amttomwh", "amttowmh"},
+    {"udxqtrhr", "udxqtrrh"},
+    {"rtieoqraf", "rteioqraf"},
+    {"ndioeirao", "ndioeriao"},
+    {"cdahsclu", "cdahscul"},
+    {"atfnlhqle", "atnflhqle"},
+    {"aimncwl", "amincwl"},
+    {"lkdnmcdt", "ldknmcdt"},
+    {"sfw'skrv", "sfwksrv"},
+    {"qterapjn", "qtreapjn"},
+    {"hcneihni", "hnceihni"},
+    {"pussixxk", "pusisxxk"},
+    {"saddkmth", "saddmkth"},
+    {"cgtnwtw", "cgtntww"},
+    {"dwmadsroi", "dwmadsrio"},
+    {"nnibudsta", "nniubdsta"},
+    {"ahmnainxy", "ahmaninxy"},
+    {":kemydihe", "kemydhie"},
+    {"evwiwldw", "evwwildw"},
+    {"oeydirn", "oeyidrn"},
+    {"fehieak", "fehiaek"},
+    {"ihcsgueana", "ihcsugeana"},
+    {"isigame", "isigmae"},
+    {"roindfzah", "roindfazh"},
+    {"rszrriumk", "rzsrriumk"},
+    {"sgmlprv", "sgmlrpv"},
+    {"aosnoagisy", "aonsoagisy"},
+    {"eutpatrine", "euptatrine"},
+    {"gwfafdtng", "gwfafdtgn"},
+    {"cwduiar", "cwdiuar"},
+    {"ihjmdht", "ijhmdht"},
+    {"ddtsaar:", "ddstaar"},
+    {"idodegoxgp", "idodgeoxgp"},
+    {"tdavhkhrw", "tdavhkhwr"},
+    {"tyysottadm", "tyystotadm"},
+    {"non'icdso", "nnoicdso"},
+    {":kqslwmln", "kqlswmln"},
+    {"dffenmar", "dffnemar"},
+    {"hyayhla", "hyahyla"},
+    {"ndyfmsiatn", "ndyfmsaitn"},
+    {"yylaieutem", "yylaeiutem"},
+    {"efluchatos:", "elfuchatos"},
+    {"fydteyfo", "fdyteyfo"},
+    {"tnhdryqii", "tnhrdyqii"},
+    {"wlsehcwtno", "wlsehwctno"},
+    {"olulhhihne", "oluhlhihne"},
+    {"fyseflns", "fyseflsn"},
+    {"gqgthawoal", "gqgthaowal"},
+    {"euoihweh", "euiohweh"},
+    {"himaisjlx", "himiasjlx"},
+    {"enoiecn", "enoeicn"},
+    {"araynmrz", "aranymrz"},
+    {"mvrmdtxaw", "mvrmdtxwa"},
+    {"rkdseaw", "rkdsewa"},
+    {"owgtinrveo", "owgtinrvoe"},
+    {"kpguewliui", "kpguweliui"},
+    {"lhxtreo", "lxhtreo"},
+    {"ottizkolo", "ottizoklo"},
+    {"shptmoofd", "shptomofd"},
+    {"ifkgtil", "ifkgitl"},
+    {"sdnnrdt", "sndnrdt"},
+    {"lttosgi", "lttsogi"},
+    {"nteeatnna", "nteeatnan"},
+    {"otisciog:", "otsiciog"},
+    {"sztarowosc", "sztraowosc"},
+    {"uik'wonf", "uikwnof"},
+    {"fneidfb", "fneidbf"},
+    {"mtnpvaoh", "mtpnvaoh"},
+    {"fsyesnala", "fsysenala"},
+    {"kutcyynen", "kutcyynne"},
+    {"pncetqfbcn", "pcnetqfbcn"},
+    {"omeglblyri:", "omeglblryi"},
+    {"ifaasdns", "ifaasdsn"},
+    {"zkgurco", "zkgucro"},
+    {"lnfeaure", "lfneaure"},
+    {"tdanysngmi", "tadnysngmi"},
+    {"ikdeuvh", "idkeuvh"},
+    {"atytagnwsd", "atytagnswd"},
+    {"yrdimdus", "yridmdus"},
+    {"ttonesooa", "ttoensooa"},
+    {"rhoriurv", "rhoirurv"},
+    {"aghnoqnsft", "aghonqnsft"},
+    {"olyodhr", "olyodrh"},
+    {"deo'ueor", "deoeuor"},
+    {"thiucdmsto", "thicudmsto"},
+    {"usofedeyun", "usoefdeyun"},
+    {"doniwia", "doniiwa"},
+    {"rocrqhhdyh", "rorcqhhdyh"},
+    {"iuoiidlwr", "iuoiildwr"},
+    {"wtknrroo", "wktnrroo"},
+    {"reenwnhr", "reenwnrh"},
+    {"ufeoffcfif", "ufefofcfif"},
+    {"wiautnt", "waiutnt"},
+    {"diigruari", "diigruair"},
+    {"dplowhmrvx", "dplohwmrvx"},
+    {"splrhrue", "sprlhrue"},
+    {"awaeniolr", "awaeniorl"},
+    {"agnmndaefi", "agnmndaeif"},
+    {"iemdroj", "iemrdoj"},
+    {"pkridnutea", "pkrdinutea"},
+    {"maswctuc", "mawsctuc"},
+    {"risomctio", "risomcito"},
+    {"ehfoaefdsi", "ehfoafedsi"},
+    {"enpjepkh", "enjpepkh"},
+    {"cfridqeot", "crfidqeot"},
+    {"hrwhlnpo", "hrwlhnpo"},
+    {"rcqarakd", "rcqarkad"},
+    {"onlchnnd", "olnchnnd"},
+    {"oda'hfuplqb", "odahfpulqb"},
+    {"gaodfuayri:", "gaodfuaryi"},
+    {"laranxgc", "laraxngc"},
+    {"hbodtav", "hbotdav"},
+    {"diilsjho", "dilisjho"},
+    {"rilgoxfrta", "rilgoxrfta"},
+    {"wuiasticgo", "wuiastigco"},
+    {"tdqesdua", "tqdesdua"},
+    {"asprrei", "aspreri"},
+    {"wteoosqhnr", "wetoosqhnr"},
+    {"kipuiah", "kipiuah"},
+    {"hjcsoaldi", "hjcosaldi"},
+    {"whaswdwna", "whsawdwna"},
+    {"trvveroif", "trvveriof"},
+    {"sdhdcwedl", "sdhdcweld"},
+    {"aisrioz", "asirioz"},
+    {"tqsnsnc", "tqsnscn"},
+    {"tedhtpihai", "tedthpihai"},
+    {"eotolcdw", "etoolcdw"},
+    {"ocsjdrdnte", "ocsjdrndte"},
+    {":nunosmnec", "nunomsnec"},
+    {"pirynnfydk", "pirnynfydk"},
+    {"osqhohm", "osqhhom"},
+    {"dernodo", "drenodo"},
+    {"exnkddfsa", "exndkdfsa"},
+    {"fisruaft", "fisruatf"},
+    {"dmureie", "dumreie"},
+    {"datdordej:", "datdrodej"},
+    {"incdeox", "indceox"},
+    {"ioduaysa", "iodauysa"},
+    {"eyfgwdp", "eyfwgdp"},
+    {"nhbrxee", "nhrbxee"},
+    {"tvwnurdwo", "tvwnurdow"},
+    {"roantced", "ronatced"},
+    {"fultryy", "flutryy"},
+    {"eirimcrl:", "eriimcrl"},
+    {"owo'mtdar", "owomtadr"},
+    {":gtowegn", "gotwegn"},
+    {"ssisajwlyh", "ssisawjlyh"},
+    {"egjnvgsa", "egjnvgas"},
+    {"htmbthdo", "htbmthdo"},
+    {"ddrrswearf", "ddrrwsearf"},
+    {"croltgrl", "crolgtrl"},
+    {"nwevrim", "newvrim"},
+    {"rsbhrsu", "rsbhsru"},
+    {"roa'ihtjy", "roaihjty"},
+    {"ydpduoin", "yddpuoin"},
+    {"oohlvar", "oolhvar"},
+    {"tnicfsg", "tnifcsg"},
+    {"omafoas:", "oamfoas"},
+    {"teyfliogwl", "teyflioglw"},
+    {"cvcshlo", "cvcshol"},
+    {"fnmvrlwu:", "fnmvrwlu"},
+    {"dioamtnc", "dioatmnc"},
+    {"rigpqrdeq", "rigpqredq"},
+    {":hiwddnno", "hidwdnno"},
+    {"htaliucn", "htaliunc"},
+    {"yhrtitly", "yhrtilty"},
+    {"osetdpkr", "osetdprk"},
+    {"afr'ndtyhbm", "afrndythbm"},
+    {"matzhirah", "matzhiarh"},
+    {"tqvegrhh", "tqverghh"},
+    {"nougunib", "nuogunib"},
+    {"dyrylswca", "dyrylwsca"},
+    {"upuoydbt", "upouydbt"},
+    {"sjeluwi", "sejluwi"},
+    {"sexrtdlr", "sextrdlr"},
+    {"siwcgss", "siwgcss"},
+    {"orphhhufmd", "orphhuhfmd"},
+    {"rhsfdiu", "rhsfidu"},
+    {"fsa'mfhlt", "fsamhflt"},
+    {"tgrunsoanl", "tgrunosanl"},
+    {"nyddrxsds", "nyddxrsds"},
+    {"setanowef", "setaonwef"},
+    {"ceamhnoyhi", "ceamhnoyih"},
+    {":nivcigte", "nicvigte"},
+    {"oxioncza", "oxinocza"},
+    {"sjaqoiatd", "sjaqoitad"},
+    {"tduhzfteh", "tduhfzteh"},
+    {"osbdjnnct", "osdbjnnct"},
+    {"accidosj", "accidojs"},
+    {"ytrvxad", "yrtvxad"},
+    {"tueettfgns", "tueettfngs"},
+    {"hrhyixeras", "hrhyixreas"},
+    {"adchofnd", "adhcofnd"},
+    {"fpmumkcirg", "fpmumkicrg"},
+    {"cthsddocq", "cthsddoqc"},
+    {"modxthfied", "modtxhfied"},
+    {"eqyinnuioa", "eqyinnuoia"},
+    {"swgaidet", "swgadiet"},
+    {"oauihgbu", "oauihgub"},
+    {"tnahnogrrg", "tnahngorrg"},
+    {"nrqarol", "nqrarol"},
+    {"iischsnw", "iicshsnw"},
+    {"ehrbitr", "ehribtr"},
+    {"ancgsecea", "angcsecea"},
+    {"zytcoeg:", "zyctoeg"},
+    {"wygtouizdn", "wgytouizdn"},
+    {"atuioynedc", "atuiyonedc"},
+    {"shnclmi", "snhclmi"},
+    {":nmwihrem", "nmwiherm"},
+    {"tnhutkn", "thnutkn"},
+    {"pqoideil", "pqoiedil"},
+    {"ooiwdoul", "ooidwoul"},
+    {"yolicnbq", "yoilcnbq"},
+    {"ylrslam", "ylrlsam"},
+    {"myhtsag", "mhytsag"},
+    {"adtdfdroyw", "adtdfdryow"},
+    {"yyfapord", "yyfapodr"},
+    {"argzarwre", "argzarwer"},
+    {"rus'klwt", "ruskltw"},
+    {"oorlhkid", "oolrhkid"},
+    {"ordahyit", "ordayhit"},
+    {"hsyqnre", "hsqynre"},
+    {"esjxngynxl:", "esjxnygnxl"},
+    {"wotaetarmt", "wtoaetarmt"},
+    {"spiotan", "spiotna"},
+    {"trztmhrij", "trzmthrij"},
+    {"lrvrdumpm", "lvrrdumpm"},
+    {"ydlbdfnrh", "ydlbdfrnh"},
+    {"cvthxzixh", "cvthxzxih"},
+};
+
+static int         corrections;
+static std::string last_correction;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    corrections++;
+    last_correction = correct;
+    // Only record the correction, typing it is covered by the autocorrect tests.
+    return false;
+}
+
+class AutocorrectBitmap : public TestFixture {
+   public:
+    void SetUp() override {
+        autocorrect_enable();
+        corrections = 0;
+        last_correction.clear();
+    }
+
+    static void Press(uint16_t keycode) {
+        keyrecord_t record   = {};
+        record.event.type    = KEY_EVENT;
+        record.event.pressed = true;
+        process_autocorrect(keycode, &record);
+    }
+
+    static void Type(const char *text) {
+        for (; *text; text++) {
+            switch (*text) {
+                case ':':
+                    Press(KC_SPC);
+                    break;
+                case '\'':
+                    Press(KC_QUOTE);
+                    break;
+                default:
+                    Press(KC_A + (*text - 'a'));
+                    break;
+            }
+        }
+    }
+};
+
+TEST_F(AutocorrectBitmap, CorrectsEveryTypo) {
+    for (const auto &entry : dictionary) {
+        // Start each typo on a word break, like after typing a previous word.
+        Press(KC_SPC);
+        corrections = 0;
+        Type(entry.typo);
+        EXPECT_EQ(corrections, 1) << "typo: " << entry.typo;
+        EXPECT_EQ(last_correction, entry.correction) << "typo: " << entry.typo;
+    }
+}
+
+TEST_F(AutocorrectBitmap, IgnoresTruncatedTypos) {
+    for (const auto &entry : dictionary) {
+        std::string typo = entry.typo;
+        if (typo.back() == ':') {
+            continue;
+        }
+        typo.pop_back();
+        Press(KC_SPC);
+        corrections = 0;
+        Type(typo.c_str());
+        EXPECT_EQ(corrections, 0) << "typo: " << typo;
+    }
+}
+
+TEST_F(AutocorrectBitmap, LookupTime) {
+    std::mt19937                           generator(36);
+    std::uniform_int_distribution<uint8_t> letter(KC_A, KC_Z);
+    const int                              presses = 200000;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < presses; i++) {
+        Press(i % 8 == 7 ? KC_SPC : letter(generator));
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    // Reported rather than asserted, as the host is not the target
+    std::cout << "autocorrect lookup: " << elapsed.count() / presses << " ns per key press, " << corrections << " corrections" << std::endl;
+    RecordProperty("ns_per_press", std::to_string(elapsed.count() / presses));
+}
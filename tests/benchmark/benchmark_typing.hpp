@@ -0,0 +1,102 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+#include "trace_benchmark.hpp"
+
+// Three rows of a staggered layout, with modifiers and editing keys on the fourth
+static const char* const benchmark_rows[] = {"qwertyuiop", "asdfghjkl;", "zxcvbnm,./"};
+
+enum benchmark_row3_cols { BENCHMARK_LSFT, BENCHMARK_RSFT, BENCHMARK_SPC, BENCHMARK_ENT, BENCHMARK_BSPC, BENCHMARK_QUOT };
+
+static const char benchmark_paragraph[] =
+    "The quick brown fox jumps over the lazy dog, and then it does so again. "
+    "Firmware spends most of its life waiting; a keyboard only has to be fast for the few moments "
+    "when somebody actually types. Those moments matter though, because every key press is "
+    "scanned, debounced, looked up in the keymap, handed to each feature in turn, and finally "
+    "turned into a report for the host.\n"
+    "Typists overlap their keys: the next one goes down before the last one comes up, "
+    "and Shift is held across Capital letters. Words like 'fales' and 'thier' get corrected, "
+    "combos and tap dances wait for their terms to pass, and overrides swap keys around.\n";
+
+/**
+ * @brief Text for the synthesized trace, the paragraph repeated `count` times.
+ */
+inline std::string benchmark_text(unsigned count = 8) {
+    std::string text;
+    for (unsigned i = 0; i < count; i++) {
+        text += benchmark_paragraph;
+    }
+    return text;
+}
+
+/**
+ * @brief Keycode of the benchmark layout at a position, KC_NO where there is no key.
+ */
+inline uint16_t benchmark_keycode(uint8_t col, uint8_t row) {
+    static const uint16_t row3[] = {KC_LSFT, KC_RSFT, KC_SPC, KC_ENT, KC_BSPC, KC_QUOT};
+    if (row == 3) {
+        return col < sizeof(row3) / sizeof(row3[0]) ? row3[col] : KC_NO;
+    }
+    char c = benchmark_rows[row][col];
+    switch (c) {
+        case ';':
+            return KC_SCLN;
+        case ',':
+            return KC_COMM;
+        case '.':
+            return KC_DOT;
+        case '/':
+            return KC_SLSH;
+        default:
+            return KC_A + (c - 'a');
+    }
+}
+
+inline keypos_t benchmark_key(uint8_t col, uint8_t row) {
+    keypos_t key = {.col = col, .row = row};
+    return key;
+}
+
+inline std::vector<keypos_t> benchmark_keys_for_char(char c) {
+    bool shifted = false;
+    if (c >= 'A' && c <= 'Z') {
+        c       = c - 'A' + 'a';
+        shifted = true;
+    }
+    switch (c) {
+        case ' ':
+            return {benchmark_key(BENCHMARK_SPC, 3)};
+        case '\n':
+            return {benchmark_key(BENCHMARK_ENT, 3)};
+        case '\'':
+            return {benchmark_key(BENCHMARK_QUOT, 3)};
+    }
+    for (uint8_t row = 0; row < 3; row++) {
+        const char* col = std::strchr(benchmark_rows[row], c);
+        if (col) {
+            keypos_t key = benchmark_key(col - benchmark_rows[row], row);
+            if (shifted) {
+                return {benchmark_key(BENCHMARK_LSFT, 3), key};
+            }
+            return {key};
+        }
+    }
+    return {};
+}
+
+/**
+ * @brief The trace to replay: the file named by QMK_BENCHMARK_TRACE if set, otherwise typing the benchmark text.
+ */
+inline KeyTrace benchmark_trace() {
+    if (const char* path = std::getenv("QMK_BENCHMARK_TRACE")) {
+        return load_key_trace(path);
+    }
+    return synthesize_key_trace(benchmark_text(), benchmark_keys_for_char);
+}
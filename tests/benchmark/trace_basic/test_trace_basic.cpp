@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../benchmark_typing.hpp"
+
+class TraceBasic : public TestFixture {};
+
+TEST_F(TraceBasic, ReplayTypingTrace) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            add_key(KeymapKey(0, col, row, benchmark_keycode(col, row)));
+        }
+    }
+
+    KeyTrace trace  = benchmark_trace();
+    auto     result = replay_key_trace(trace);
+
+    EXPECT_EQ(result.events, trace.size());
+    EXPECT_GT(result.keyboard_reports, 0u);
+    report_trace_benchmark("trace_basic", result);
+}
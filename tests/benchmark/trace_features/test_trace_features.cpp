@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../benchmark_typing.hpp"
+
+class TraceFeatures : public TestFixture {};
+
+TEST_F(TraceFeatures, ReplayTypingTrace) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t keycode = benchmark_keycode(col, row);
+            if (keycode == KC_SCLN) {
+                keycode = TD(0);
+            } else if (row == 3 && col == BENCHMARK_QUOT + 1) {
+                keycode = CW_TOGG;
+            }
+            add_key(KeymapKey(0, col, row, keycode));
+        }
+    }
+
+    KeyTrace trace  = benchmark_trace();
+    auto     result = replay_key_trace(trace);
+
+    EXPECT_EQ(result.events, trace.size());
+    EXPECT_GT(result.keyboard_reports, 0u);
+    report_trace_benchmark("trace_features", result);
+}
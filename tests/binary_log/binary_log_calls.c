@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "debug.h"
+
+// dprintf only turns into binary_log in C, so the tests call it through these
+
+void log_without_arguments(void) {
+    dprintln("scan");
+}
+
+void log_integers(int8_t small, uint16_t large, uint32_t huge) {
+    dprintf("small %d large %u huge %lu\n", small, large, huge);
+}
+
+void log_string(const char *name, uint8_t value) {
+    dprintf("%s=%u\n", name, value);
+}
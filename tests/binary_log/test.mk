@@ -0,0 +1,8 @@
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+CONSOLE_ENABLE = yes
+BINARY_LOG_ENABLE = yes
+
+SRC += binary_log_calls.c
@@ -0,0 +1,112 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "binary_log.h"
+
+void log_without_arguments(void);
+void log_integers(int8_t small, uint16_t large, uint32_t huge);
+void log_string(const char *name, uint8_t value);
+}
+
+static std::vector<uint8_t> captured;
+
+static int8_t capture_sendchar(uint8_t c) {
+    captured.push_back(c);
+    return 0;
+}
+
+struct BinaryLogRecord {
+    std::string          format;
+    std::vector<uint8_t> payload; // the arguments, without the ID
+};
+
+// Splits the captured bytes into records, looking up each format string by its ID
+static std::vector<BinaryLogRecord> captured_records() {
+    std::vector<BinaryLogRecord> records;
+    for (size_t i = 0; i < captured.size();) {
+        EXPECT_EQ(captured[i], BINARY_LOG_MARKER);
+        uint8_t  length = captured[i + 1];
+        uint16_t id     = captured[i + 2] | (captured[i + 3] << 8);
+        records.push_back({__start_qmk_log_formats + id, std::vector<uint8_t>(captured.begin() + i + 4, captured.begin() + i + 2 + length)});
+        i += 2 + length;
+    }
+    return records;
+}
+
+class BinaryLog : public TestFixture {
+   public:
+    BinaryLog() {
+        captured.clear();
+        binary_log_set_sendchar(capture_sendchar);
+        debug_config.enable = true;
+    }
+
+    ~BinaryLog() {
+        binary_log_set_sendchar(sendchar);
+    }
+};
+
+TEST_F(BinaryLog, sends_only_the_format_id) {
+    log_without_arguments();
+
+    EXPECT_EQ(captured.size(), 4);
+    auto records = captured_records();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].format, "scan\r\n");
+    EXPECT_TRUE(records[0].payload.empty());
+}
+
+TEST_F(BinaryLog, encodes_integers_as_varints) {
+    log_integers(-1, 300, 5);
+
+    auto records = captured_records();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].format, "small %d large %u huge %lu\n");
+    // -1 is sent as its 32 bit two's complement, 300 as 0xAC 0x02
+    std::vector<uint8_t> expected = {0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xAC, 0x02, 0x05};
+    EXPECT_EQ(records[0].payload, expected);
+}
+
+TEST_F(BinaryLog, sends_strings_with_terminator) {
+    log_string("layer", 2);
+
+    auto records = captured_records();
+    ASSERT_EQ(records.size(), 1);
+    EXPECT_EQ(records[0].format, "%s=%u\n");
+    std::vector<uint8_t> expected = {'l', 'a', 'y', 'e', 'r', 0, 2};
+    EXPECT_EQ(records[0].payload, expected);
+}
+
+TEST_F(BinaryLog, cuts_long_strings_and_drops_what_does_not_fit) {
+    log_string("a_very_long_layer_name", 2);
+
+    auto records = captured_records();
+    ASSERT_EQ(records.size(), 1);
+    // 16 bytes of payload: the ID, 13 characters and the terminator, but no room for the value
+    std::vector<uint8_t> expected = {'a', '_', 'v', 'e', 'r', 'y', '_', 'l', 'o', 'n', 'g', '_', 'l', 0};
+    EXPECT_EQ(records[0].payload, expected);
+}
+
+TEST_F(BinaryLog, gives_each_call_site_its_own_id) {
+    log_without_arguments();
+    log_string("x", 1);
+    log_without_arguments();
+
+    auto records = captured_records();
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0].format, records[2].format);
+    EXPECT_NE(records[0].format, records[1].format);
+}
+
+TEST_F(BinaryLog, sends_nothing_with_debug_disabled) {
+    debug_config.enable = false;
+    log_integers(1, 2, 3);
+    debug_config.enable = true;
+
+    EXPECT_TRUE(captured.empty());
+}
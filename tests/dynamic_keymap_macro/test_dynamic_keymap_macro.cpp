@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+
+static uint32_t eeprom_read_count = 0;
+
+void __real_eeprom_read_block(void *buf, const void *addr, size_t len);
+void __wrap_eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_read_count++;
+    __real_eeprom_read_block(buf, addr, len);
+}
+}
+
+using testing::_;
+using testing::InSequence;
+
+class DynamicKeymapMacro : public TestFixture {
+   protected:
+    void SetUp() override {
+        TestFixture::SetUp();
+        dynamic_keymap_macro_reset();
+    }
+
+    /* Writes the macros back to back, each followed by its null terminator */
+    void set_macros(std::initializer_list<std::string> macros) {
+        std::string buffer;
+        for (const auto &macro : macros) {
+            buffer += macro;
+            buffer += '\0';
+        }
+        dynamic_keymap_macro_set_buffer(0, buffer.size(), (uint8_t *)buffer.data());
+    }
+};
+
+TEST_F(DynamicKeymapMacro, SendsTheRequestedMacro) {
+    TestDriver driver;
+    set_macros({"ab", "cd", "hi"});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_I));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, MissingMacroSendsNothing) {
+    TestDriver driver;
+    set_macros({"ab"});
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(DYNAMIC_KEYMAP_MACRO_COUNT);
+    dynamic_keymap_macro_send(5);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, IncompleteBufferWriteSendsNothing) {
+    TestDriver driver;
+    set_macros({"ab"});
+    uint8_t busy = 0xFF;
+    dynamic_keymap_macro_set_buffer(dynamic_keymap_macro_get_buffer_size() - 1, 1, &busy);
+
+    EXPECT_NO_REPORT(driver);
+    dynamic_keymap_macro_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(DynamicKeymapMacro, MacrosAreLocatedAndReadInChunks) {
+    TestDriver driver;
+    std::string long_macro(100, 'a');
+    set_macros({long_macro, long_macro, "hi"});
+
+    EXPECT_ANY_REPORT(driver).Times(4);
+    eeprom_read_count = 0;
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+    // Indexing scans the 203 bytes up to the third macro plus the empty ones after it,
+    // then the validity byte and the macro itself are read
+    uint32_t scanned = 2 * (long_macro.size() + 1) + 3 + (DYNAMIC_KEYMAP_MACRO_COUNT - 3);
+    EXPECT_LE(eeprom_read_count, (scanned + 15) / 16 + 2);
+
+    // Once indexed, only the validity byte and one chunk of the macro are read
+    EXPECT_ANY_REPORT(driver).Times(4);
+    eeprom_read_count = 0;
+    dynamic_keymap_macro_send(2);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(eeprom_read_count, 2);
+}
+
+TEST_F(DynamicKeymapMacro, IndexFollowsBufferChanges) {
+    TestDriver driver;
+    set_macros({"a", "b"});
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+
+    set_macros({"aaaa", "c"});
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    dynamic_keymap_macro_send(1);
+    VERIFY_AND_CLEAR(driver);
+}
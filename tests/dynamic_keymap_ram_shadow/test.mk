@@ -0,0 +1,5 @@
+DYNAMIC_KEYMAP_ENABLE = yes
+EEPROM_DRIVER = transient
+
+# Count the accesses that make it to the EEPROM driver
+LDFLAGS += -Wl,--wrap=eeprom_read_block -Wl,--wrap=eeprom_write_block
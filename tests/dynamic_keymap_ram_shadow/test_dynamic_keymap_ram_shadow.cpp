@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+
+static uint32_t eeprom_read_count  = 0;
+static uint32_t eeprom_write_count = 0;
+
+void __real_eeprom_read_block(void *buf, const void *addr, size_t len);
+void __wrap_eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_read_count++;
+    __real_eeprom_read_block(buf, addr, len);
+}
+
+void __real_eeprom_write_block(const void *buf, void *addr, size_t len);
+void __wrap_eeprom_write_block(const void *buf, void *addr, size_t len) {
+    eeprom_write_count++;
+    __real_eeprom_write_block(buf, addr, len);
+}
+}
+
+class DynamicKeymapRamShadow : public TestFixture {
+   protected:
+    void reset_counts(void) {
+        eeprom_read_count  = 0;
+        eeprom_write_count = 0;
+    }
+
+    /* The keycode as stored in EEPROM, big endian */
+    uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        uint8_t bytes[2];
+        __real_eeprom_read_block(bytes, (const void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + ((layer * MATRIX_ROWS + row) * MATRIX_COLS + column) * 2), sizeof(bytes));
+        return (bytes[0] << 8) | bytes[1];
+    }
+};
+
+TEST_F(DynamicKeymapRamShadow, KeycodeReadsComeFromTheShadow) {
+    dynamic_keymap_get_keycode(0, 0, 0);
+
+    reset_counts();
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), eeprom_keycode(layer, row, column));
+            }
+        }
+    }
+    EXPECT_EQ(eeprom_read_count, 0);
+}
+
+TEST_F(DynamicKeymapRamShadow, UpdatesAreWrittenThrough) {
+    dynamic_keymap_set_keycode(1, 2, 3, LCTL(KC_B));
+
+    reset_counts();
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), LCTL(KC_B));
+    EXPECT_EQ(eeprom_read_count, 0);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), LCTL(KC_B));
+}
+
+TEST_F(DynamicKeymapRamShadow, UnchangedUpdatesSkipEeprom) {
+    dynamic_keymap_set_keycode(0, 1, 1, KC_C);
+
+    reset_counts();
+    dynamic_keymap_set_keycode(0, 1, 1, KC_C);
+    EXPECT_EQ(eeprom_read_count, 0);
+    EXPECT_EQ(eeprom_write_count, 0);
+}
+
+TEST_F(DynamicKeymapRamShadow, BufferAccessGoesThroughTheShadow) {
+    // Layer 0, row 0, columns 1 and 2
+    uint8_t keycodes[] = {0x00, KC_D, 0x00, KC_E};
+    dynamic_keymap_set_buffer(2, sizeof(keycodes), keycodes);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_D);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 2), KC_E);
+    EXPECT_EQ(eeprom_keycode(0, 0, 1), KC_D);
+    EXPECT_EQ(eeprom_keycode(0, 0, 2), KC_E);
+
+    dynamic_keymap_set_keycode(0, 0, 2, KC_F);
+
+    uint8_t buffer[4];
+    reset_counts();
+    dynamic_keymap_get_buffer(2, sizeof(buffer), buffer);
+    EXPECT_EQ(eeprom_read_count, 0);
+    EXPECT_EQ(buffer[1], KC_D);
+    EXPECT_EQ(buffer[3], KC_F);
+    EXPECT_EQ(eeprom_keycode(0, 0, 2), KC_F);
+}
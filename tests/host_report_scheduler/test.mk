@@ -0,0 +1,2 @@
+MOUSEKEY_ENABLE = yes
+EXTRAKEY_ENABLE = yes
@@ -0,0 +1,206 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "host.h"
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InSequence;
+
+class HostReportScheduler : public TestFixture {
+   protected:
+    /* Pretends the host polled an interrupt endpoint with a backlog every interval milliseconds */
+    void learn_poll_interval(uint8_t interval) {
+        for (uint8_t i = 0; i < 2 * HOST_REPORT_SCHEDULER_WINDOW; i++) {
+            host_report_serviced(1, true);
+            advance_time(interval);
+        }
+        host_report_serviced(1, false);
+        ASSERT_EQ(host_report_service_interval(), interval);
+    }
+
+    report_mouse_t mouse_report(int8_t x, int8_t y, uint8_t buttons) {
+        report_mouse_t report = {};
+        report.x              = x;
+        report.y              = y;
+        report.buttons        = buttons;
+        return report;
+    }
+};
+
+TEST_F(HostReportScheduler, ReportsAreSentImmediatelyForFastHosts) {
+    TestDriver driver;
+    learn_poll_interval(1);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    report_mouse_t report = mouse_report(1, 0, 0);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, MouseMovementIsMergedUntilJustBeforeThePoll) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    report_mouse_t report = mouse_report(1, -2, 0);
+    host_mouse_send(&report);
+    report = mouse_report(3, -4, 0);
+    host_mouse_send(&report);
+    idle_for(7);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (4, -6, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(16);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, ButtonChangesAreNotMerged) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    InSequence s;
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 1));
+    report_mouse_t report = mouse_report(1, 0, 0);
+    host_mouse_send(&report);
+    report = mouse_report(2, 0, 1);
+    host_mouse_send(&report);
+    idle_for(8);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, ReplacingAHeldReportFlushesEverythingHeld) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(0);
+    host_consumer_send(AUDIO_VOL_UP);
+    idle_for(2);
+    report_mouse_t report = mouse_report(1, 0, 0);
+    host_mouse_send(&report);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    // The usage held since the start must not wait for another full interval behind the replacement
+    InSequence s;
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    EXPECT_CALL(driver, send_extra_mock(_));
+    report = mouse_report(2, 0, 1);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 1));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, OverflowingMovementIsNotMerged) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    InSequence s;
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    report_mouse_t report = mouse_report(MOUSE_REPORT_XY_MAX, 0, 0);
+    host_mouse_send(&report);
+    report = mouse_report(1, 0, 0);
+    host_mouse_send(&report);
+    idle_for(8);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, KeyboardReportsAreNeverDeferred) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+    learn_poll_interval(8);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, HeldReportsAreSentBeforeKeyboardReports) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_LCTL);
+    set_keymap({key});
+    learn_poll_interval(8);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    report_mouse_t report = mouse_report(0, 0, 1);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+
+    // A click followed by Ctrl must not reach the host as Ctrl+click
+    InSequence s;
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, HeldReportsAreSentBeforeImmediateReports) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(0);
+    host_consumer_send(AUDIO_VOL_UP);
+    VERIFY_AND_CLEAR(driver);
+
+    // Once the host polls fast enough for reports to go out straight away, the held one still goes first
+    learn_poll_interval(1);
+    InSequence s;
+    EXPECT_CALL(driver, send_extra_mock(_));
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    report_mouse_t report = mouse_report(1, 0, 0);
+    host_mouse_send(&report);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_extra_mock(_));
+    host_consumer_send(0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostReportScheduler, IntervalIsRelearnedFromHeldReports) {
+    TestDriver driver;
+    learn_poll_interval(8);
+
+    // The host now polls every 16ms and only ever finds a single held report waiting
+    EXPECT_ANY_MOUSE_REPORT(driver).Times(2 * HOST_REPORT_SCHEDULER_WINDOW);
+    for (uint8_t i = 0; i < 2 * HOST_REPORT_SCHEDULER_WINDOW; i++) {
+        report_mouse_t report = mouse_report(1, 0, 0);
+        host_mouse_send(&report);
+        idle_for(16);
+        host_report_serviced(1, false);
+    }
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(host_report_service_interval(), 16);
+}
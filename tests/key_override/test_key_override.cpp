@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+extern "C" {
+extern key_override_t runtime_override;
+}
+
+class KeyOverride : public TestFixture {
+   public:
+    void SetUp() override {
+        runtime_override.trigger = KC_3;
+        key_override_invalidate_index();
+    }
+
+    // Any reports are fine, as long as the ones expected afterwards are among them
+    void allow_other_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    }
+};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    auto       shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       bspc  = KeymapKey(0, 1, 0, KC_BSPC);
+    set_keymap({shift, bspc});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_DEL)).Times(1);
+    EXPECT_REPORT(driver, (KC_LSFT, KC_BSPC)).Times(0);
+    shift.press();
+    run_one_scan_loop();
+    tap_key(bspc);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, FirstMatchingOverrideWins) {
+    TestDriver driver;
+    auto       shift = KeymapKey(0, 0, 0, KC_LSFT);
+    auto       one   = KeymapKey(0, 1, 0, KC_1);
+    set_keymap({shift, one});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F1)).Times(1);
+    EXPECT_REPORT(driver, (KC_F2)).Times(0);
+    shift.press();
+    run_one_scan_loop();
+    tap_key(one);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, LaterOverrideMatchesOtherSide) {
+    TestDriver driver;
+    auto       shift = KeymapKey(0, 0, 0, KC_RSFT);
+    auto       one   = KeymapKey(0, 1, 0, KC_1);
+    set_keymap({shift, one});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F1)).Times(0);
+    EXPECT_REPORT(driver, (KC_F2)).Times(1);
+    shift.press();
+    run_one_scan_loop();
+    tap_key(one);
+    shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModPressedWhileTriggerHeld) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       a    = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({ctrl, a});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_B)).Times(1);
+    a.press();
+    run_one_scan_loop();
+    ctrl.press();
+    // The replacement is registered after the default 500ms key repeat delay
+    idle_for(510);
+    a.release();
+    run_one_scan_loop();
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, NoTriggerOverride) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       alt  = KeymapKey(0, 1, 0, KC_LALT);
+    set_keymap({ctrl, alt});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F13)).Times(1);
+    ctrl.press();
+    run_one_scan_loop();
+    alt.press();
+    // A modifier event defers the replacement until the key repeat delay has passed
+    idle_for(510);
+    alt.release();
+    run_one_scan_loop();
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, OneModOption) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       two  = KeymapKey(0, 1, 0, KC_2);
+    set_keymap({ctrl, two});
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F3)).Times(1);
+    ctrl.press();
+    run_one_scan_loop();
+    tap_key(two);
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, MissingModsDoNotActivate) {
+    TestDriver driver;
+    auto       one = KeymapKey(0, 0, 0, KC_1);
+    auto       a   = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({one, a});
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    EXPECT_REPORT(driver, (KC_A));
+    tap_key(one);
+    tap_key(a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggerChangedAtRuntime) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       c    = KeymapKey(0, 1, 0, KC_C);
+    set_keymap({ctrl, c});
+
+    // Build the index with the original trigger
+    tap_key(c);
+    VERIFY_AND_CLEAR(driver);
+
+    // KC_C sorts before the triggers KC_X to KC_2, so the override moves within the index
+    runtime_override.trigger = KC_C;
+    key_override_invalidate_index();
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F4)).Times(1);
+    EXPECT_REPORT(driver, (KC_LCTL, KC_C)).Times(0);
+    ctrl.press();
+    run_one_scan_loop();
+    tap_key(c);
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggerChangedWithoutInvalidatingIndex) {
+    TestDriver driver;
+    auto       ctrl = KeymapKey(0, 0, 0, KC_LCTL);
+    auto       c    = KeymapKey(0, 1, 0, KC_C);
+    set_keymap({ctrl, c});
+
+    // Build the index with the original trigger
+    tap_key(c);
+    VERIFY_AND_CLEAR(driver);
+
+    // The override is still filed under KC_3, so it is never found for KC_C
+    runtime_override.trigger = KC_C;
+
+    allow_other_reports(driver);
+    EXPECT_REPORT(driver, (KC_F4)).Times(0);
+    EXPECT_REPORT(driver, (KC_LCTL, KC_C)).Times(1);
+    ctrl.press();
+    run_one_scan_loop();
+    tap_key(c);
+    ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
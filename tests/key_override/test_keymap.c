@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+#define GUI_FILLER(kc) ko_make_basic(MOD_MASK_GUI, kc, KC_NO)
+
+// Overrides that share triggers with the ones below, but never match as GUI is never pressed
+const key_override_t filler_overrides[] = {
+    GUI_FILLER(KC_1), GUI_FILLER(KC_2), GUI_FILLER(KC_A), GUI_FILLER(KC_NO), GUI_FILLER(KC_BSPC), GUI_FILLER(KC_Z), GUI_FILLER(KC_Y), GUI_FILLER(KC_X),
+};
+
+const key_override_t delete_override      = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_a_override      = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_B);
+const key_override_t ctrl_alt_override    = ko_make_basic(MOD_MASK_CA, KC_NO, KC_F13);
+const key_override_t left_shift_override  = ko_make_basic(MOD_BIT(KC_LSFT), KC_1, KC_F1);
+const key_override_t any_shift_override   = ko_make_basic(MOD_MASK_SHIFT, KC_1, KC_F2);
+const key_override_t one_mod_override     = ko_make_with_layers_negmods_and_options(MOD_MASK_CS, KC_2, KC_F3, ~0, 0, ko_options_default | ko_option_one_mod);
+key_override_t       runtime_override     = ko_make_basic(MOD_MASK_CTRL, KC_3, KC_F4);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &filler_overrides[0], &filler_overrides[1], &filler_overrides[2], &filler_overrides[3],
+    &delete_override,
+    &filler_overrides[4], &filler_overrides[5],
+    &ctrl_a_override,
+    &ctrl_alt_override,
+    &left_shift_override,
+    &any_shift_override,
+    &filler_overrides[6],
+    &one_mod_override,
+    &runtime_override,
+    &filler_overrides[7],
+};
+// clang-format on
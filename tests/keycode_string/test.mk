@@ -12,11 +12,17 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+# Every feature with entries in common_names, to check that they are all sorted
+CAPS_WORD_ENABLE = yes
 EXTRAKEY_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
 KEYCODE_STRING_ENABLE = yes
 KEY_LOCK_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+LEADER_ENABLE = yes
 MAGIC_ENABLE = yes
 MOUSEKEY_ENABLE = yes
 PROGRAMMABLE_BUTTON_ENABLE = yes
 SECURE_ENABLE = yes
 SWAP_HANDS_ENABLE = yes
+TRI_LAYER_ENABLE = yes
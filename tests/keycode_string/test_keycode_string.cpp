@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
 #include "test_common.hpp"
 
@@ -24,10 +27,16 @@ enum {
 // clang-format off
 extern "C" {
 
+// Sorted by keycode, so that it is binary searched.
 KEYCODE_STRING_NAMES_KB(
+    KEYCODE_STRING_NAME(KC_AT),
+    KEYCODE_STRING_NAME(KC_HASH),
+    {KC_HASH, "KC_HASH_AGAIN"},
     KEYCODE_STRING_NAME(MYMACRO1),
 );
 
+// Not sorted, so that it is scanned.
+
 KEYCODE_STRING_NAMES_USER(
     KEYCODE_STRING_NAME(MYMACRO2),
     KEYCODE_STRING_NAME(KC_EXLM),
@@ -142,12 +151,49 @@ TEST_F(KeycodeStringTest, get_keycode_string) {
              {QK_MAGIC + 7, "QK_MAGIC+7"},
              // Quantum keycodes.
              {QK_LOCK, "QK_LOCK"},
+             {QK_GESC, "QK_GESC"},
+             {QK_LEAD, "QK_LEAD"},
+             {QK_LLCK, "QK_LLCK"},
+             {CW_TOGG, "CW_TOGG"},
+             {TL_LOWR, "TL_LOWR"},
+             {TL_UPPR, "TL_UPPR"},
              {QK_QUANTUM + 7, "QK_QUANTUM+7"},
              // Custom keycode names.
              {MYMACRO1, "MYMACRO1"},
              {MYMACRO2, "MYMACRO2"},
              {KC_EXLM, "KC_EXLM"},
+             {KC_AT, "KC_AT"},
+             {KC_HASH, "KC_HASH"},
+             {KC_DLR, "S(KC_4)"},
          })) {
         EXPECT_EQ(get_keycode_string(keycode), expected) << "where keycode = 0x" << std::hex << keycode;
     }
 }
+
+TEST_F(KeycodeStringTest, common_names_sorted) {
+    // Binary search of the built-in names relies on this, and test.mk enables every feature that adds to them
+    EXPECT_TRUE(keycode_string_common_names_sorted());
+}
+
+// Not run by default, run the test binary with --gtest_also_run_disabled_tests to measure.
+TEST_F(KeycodeStringTest, DISABLED_benchmark) {
+    constexpr int rounds = 20;
+    size_t        length = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (uint32_t keycode = 0; keycode <= 0xFFFF; ++keycode) {
+            length += strlen(get_keycode_string(keycode));
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const double ns_per_call = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / (rounds * 0x10000);
+    EXPECT_GT(length, 0);
+
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(0);
+    summary << "get_keycode_string: " << ns_per_call << " ns per call over all keycodes" << std::endl;
+    std::cout << summary.str();
+    testing::Test::RecordProperty("ns_per_call", std::to_string((uint64_t)ns_per_call));
+}
@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Listed out of order, the table is sorted when the leader key is first pressed
+const leader_table_entry_t leader_table[] = {
+    LEADER_TABLE_ENTRY(KC_4, KC_D, KC_E),
+    LEADER_TABLE_ENTRY(KC_3, KC_A, KC_B, KC_C),
+    LEADER_TABLE_ENTRY(KC_1, KC_A),
+    LEADER_TABLE_ENTRY(LSFT(KC_5), KC_F, KC_F, KC_F, KC_F, KC_F),
+    LEADER_TABLE_ENTRY(KC_2, KC_A, KC_B),
+    LEADER_TABLE_ENTRY(KC_NO, KC_G),
+};
+
+uint8_t leader_table_matched_index = UINT8_MAX;
+
+bool leader_table_matched_user(uint8_t index) {
+    leader_table_matched_index = index;
+    return true;
+}
+
+bool leader_add_user_ends_sequence = false;
+
+bool leader_add_user(uint16_t keycode) {
+    return leader_add_user_ends_sequence;
+}
@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LEADER_ENABLE = yes
+LEADER_TABLE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = leader_table.c
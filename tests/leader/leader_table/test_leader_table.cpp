@@ -0,0 +1,229 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+extern "C" {
+extern uint8_t leader_table_matched_index;
+extern bool    leader_add_user_ends_sequence;
+}
+
+class LeaderTable : public TestFixture {
+   public:
+    void SetUp() override {
+        leader_table_matched_index    = UINT8_MAX;
+        leader_add_user_ends_sequence = false;
+    }
+};
+
+TEST_F(LeaderTable, unique_sequence_fires_without_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+    auto key_e      = KeymapKey(0, 2, 0, KC_E);
+
+    set_keymap({key_leader, key_d, key_e});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_e);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, 0);
+}
+
+TEST_F(LeaderTable, longest_sequence_fires_without_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+    auto key_c      = KeymapKey(0, 3, 0, KC_C);
+
+    set_keymap({key_leader, key_a, key_b, key_c});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, 1);
+}
+
+TEST_F(LeaderTable, prefix_of_longer_sequence_waits_for_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    idle_for(250);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, 2);
+}
+
+TEST_F(LeaderTable, middle_sequence_fires_on_timeout) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_b      = KeymapKey(0, 2, 0, KC_B);
+
+    set_keymap({key_leader, key_a, key_b});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(350);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_table_matched_index, 4);
+}
+
+TEST_F(LeaderTable, five_key_sequence_with_modifiers) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_f      = KeymapKey(0, 1, 0, KC_F);
+
+    set_keymap({key_leader, key_f});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_keys(key_f, key_f, key_f, key_f);
+    VERIFY_AND_CLEAR(driver);
+
+    {
+        testing::InSequence s;
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_5));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    tap_key(key_f);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderTable, no_match_ends_sequence_early) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+    auto key_x      = KeymapKey(0, 2, 0, KC_X);
+
+    set_keymap({key_leader, key_a, key_x});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, UINT8_MAX);
+
+    // The next key is typed as usual, without waiting for the timeout
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderTable, entry_without_keycode_calls_user_callback) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_g      = KeymapKey(0, 1, 0, KC_G);
+
+    set_keymap({key_leader, key_g});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_g);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, 5);
+}
+
+TEST_F(LeaderTable, sequence_ended_by_user_only_fires_matching_entry) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_d      = KeymapKey(0, 1, 0, KC_D);
+
+    set_keymap({key_leader, key_d});
+
+    // (KC_D) is only the start of (KC_D, KC_E), and must not fire the first entry of the whole table, (KC_A)
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    leader_add_user_ends_sequence = true;
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, UINT8_MAX);
+}
+
+TEST_F(LeaderTable, sequence_ended_by_user_fires_complete_entry) {
+    TestDriver driver;
+
+    auto key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    auto key_a      = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_leader, key_a});
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    leader_add_user_ends_sequence = true;
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_table_matched_index, 2);
+}
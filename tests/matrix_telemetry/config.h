@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DEBOUNCE 5
+#define MATRIX_TELEMETRY_REPORT_INTERVAL 0
+
+/* Scans are timed with a microsecond counter that the tests advance themselves */
+#define MATRIX_TELEMETRY_COUNTER() matrix_telemetry_test_us
+#define MATRIX_TELEMETRY_COUNTER_TO_US(ticks) (ticks)
+#define MATRIX_TELEMETRY_SCAN_BUCKET_US 50
+
+#ifndef __ASSEMBLER__
+#    include <stdint.h>
+#    ifdef __cplusplus
+extern "C" {
+#    endif
+extern uint32_t matrix_telemetry_test_us;
+#    ifdef __cplusplus
+}
+#    endif
+#endif
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+MATRIX_TELEMETRY_ENABLE = yes
+DEBOUNCE_TYPE = sym_defer_pk
@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "debounce.h"
+#include "matrix_telemetry.h"
+void advance_time(uint32_t ms);
+
+uint32_t matrix_telemetry_test_us = 0;
+}
+
+class MatrixTelemetry : public TestFixture {
+   protected:
+    void SetUp() override {
+        memset(raw_, 0, sizeof(raw_));
+        memset(cooked_, 0, sizeof(cooked_));
+        debounce_init();
+        matrix_telemetry_reset();
+    }
+
+    /* Runs one debounce pass over the raw matrix, like matrix_scan() does. */
+    void scan(bool changed = false) {
+        debounce(raw_, cooked_, changed);
+        matrix_telemetry_scan(raw_, cooked_);
+    }
+
+    /* Moves both the millisecond timer and the microsecond counter on. */
+    void advance_us(uint32_t us) {
+        matrix_telemetry_test_us += us;
+        advance_time((matrix_telemetry_test_us / 1000) - (matrix_telemetry_test_us - us) / 1000);
+    }
+
+    /* Scans once per millisecond for the given duration. */
+    void scan_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_us(1000);
+            scan();
+        }
+    }
+
+    void toggle(uint8_t row, uint8_t col) {
+        raw_[row] ^= (matrix_row_t)1 << col;
+        scan(true);
+    }
+
+    matrix_telemetry_stats_t stats() {
+        matrix_telemetry_stats_t stats;
+        matrix_telemetry_get_stats(&stats);
+        return stats;
+    }
+
+    matrix_row_t raw_[MATRIX_ROWS];
+    matrix_row_t cooked_[MATRIX_ROWS];
+};
+
+TEST_F(MatrixTelemetry, CleanPressAndReleaseTakeDebounceTime) {
+    toggle(0, 1);
+    scan_for(10);
+    toggle(0, 1);
+    scan_for(10);
+
+    auto s = stats();
+    EXPECT_EQ(s.debounce_latency.count, 2);
+    EXPECT_EQ(s.debounce_latency.p50, DEBOUNCE);
+    EXPECT_EQ(s.debounce_latency.max, DEBOUNCE);
+    EXPECT_EQ(cooked_[0], 0);
+}
+
+TEST_F(MatrixTelemetry, BounceDelaysReleaseFromFirstEdge) {
+    toggle(1, 2);
+    scan_for(2);
+    /* Contact bounce restarts the per-key timer */
+    toggle(1, 2);
+    toggle(1, 2);
+    scan_for(10);
+
+    auto s = stats();
+    EXPECT_EQ(s.debounce_latency.count, 1);
+    EXPECT_EQ(s.debounce_latency.max, DEBOUNCE + 2);
+}
+
+TEST_F(MatrixTelemetry, NoiseIsNotCounted) {
+    toggle(2, 3);
+    advance_us(1000);
+    toggle(2, 3);
+    scan_for(10);
+
+    EXPECT_EQ(stats().debounce_latency.count, 0);
+}
+
+TEST_F(MatrixTelemetry, Percentiles) {
+    /* 90 clean edges, then 10 delayed by a bounce */
+    for (int i = 0; i < 90; i++) {
+        toggle(0, 0);
+        scan_for(10);
+    }
+    for (int i = 0; i < 10; i++) {
+        toggle(0, 0);
+        scan_for(3);
+        toggle(0, 0);
+        toggle(0, 0);
+        scan_for(10);
+    }
+
+    auto s = stats();
+    EXPECT_EQ(s.debounce_latency.count, 100);
+    EXPECT_EQ(s.debounce_latency.p50, DEBOUNCE);
+    EXPECT_EQ(s.debounce_latency.p90, DEBOUNCE);
+    EXPECT_EQ(s.debounce_latency.p99, DEBOUNCE + 3);
+    EXPECT_EQ(s.debounce_latency.max, DEBOUNCE + 3);
+}
+
+TEST_F(MatrixTelemetry, ScanIntervalJitter) {
+    /* Scans well under a millisecond apart, which the millisecond timer can't tell apart */
+    scan();
+    for (int i = 0; i < 180; i++) {
+        advance_us(230);
+        scan();
+    }
+    for (int i = 0; i < 18; i++) {
+        advance_us(420);
+        scan();
+    }
+    /* One stalled scan */
+    advance_us(12345);
+    scan();
+
+    auto s = stats();
+    EXPECT_EQ(s.scan_interval.count, 199);
+    EXPECT_EQ(s.scan_interval.p50, 200);
+    EXPECT_EQ(s.scan_interval.p90, 200);
+    EXPECT_EQ(s.scan_interval.p99, 400);
+    EXPECT_EQ(s.scan_interval.max, 12345);
+}
+
+TEST_F(MatrixTelemetry, ScanRate) {
+    scan_for(1200);
+    EXPECT_EQ(stats().scan_rate, 1000);
+}
+
+TEST_F(MatrixTelemetry, Serialize) {
+    toggle(0, 1);
+    scan_for(10);
+
+    uint8_t data[32] = {0};
+    EXPECT_EQ(matrix_telemetry_serialize(data, 8), 0);
+    EXPECT_EQ(matrix_telemetry_serialize(data, sizeof(data)), 28);
+    /* Debounce latency count, then p50 */
+    EXPECT_EQ(data[0], 1);
+    EXPECT_EQ(data[4], DEBOUNCE);
+    EXPECT_EQ(data[10], DEBOUNCE);
+}
+
+TEST_F(MatrixTelemetry, RawHid) {
+    toggle(0, 1);
+    scan_for(10);
+
+    uint8_t data[32]  = {MATRIX_TELEMETRY_RAW_HID_COMMAND};
+    uint8_t other[32] = {MATRIX_TELEMETRY_RAW_HID_COMMAND + 1};
+    EXPECT_FALSE(matrix_telemetry_raw_hid_receive(other, sizeof(other)));
+
+    EXPECT_TRUE(matrix_telemetry_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], MATRIX_TELEMETRY_RAW_HID_COMMAND);
+    EXPECT_EQ(data[1], 1);
+    EXPECT_EQ(data[5], DEBOUNCE);
+    EXPECT_EQ(stats().debounce_latency.count, 1);
+
+    /* Reading with the reset flag clears the statistics afterwards */
+    memset(data, 0, sizeof(data));
+    data[0] = MATRIX_TELEMETRY_RAW_HID_COMMAND;
+    data[1] = MATRIX_TELEMETRY_RAW_HID_RESET;
+    EXPECT_TRUE(matrix_telemetry_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 1);
+    EXPECT_EQ(stats().debounce_latency.count, 0);
+}
@@ -0,0 +1 @@
+SEND_STRING_ENABLE = yes
@@ -0,0 +1,184 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class SendStringAsync : public TestFixture {
+   protected:
+    void TearDown() override {
+        send_string_async_cancel();
+        TestFixture::TearDown();
+    }
+};
+
+TEST_F(SendStringAsync, TypesOneKeyEventPerTask) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_TRUE(send_string_async("ab"));
+    EXPECT_TRUE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, ShiftedCharactersAndKeycodes) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("A" SS_LCTL("c") SS_TAP(X_ENTER));
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, StringsAreTypedInQueueOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("a");
+    send_string_async("b");
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, IntervalIsWaitedOutBetweenKeyEvents) {
+    TestDriver driver;
+
+    send_string_async_with_delay("a", 10);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(9);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, KeyboardKeepsRunningDuringDelay) {
+    TestDriver driver;
+    KeymapKey  key_c = KeymapKey(0, 0, 0, KC_C);
+    set_keymap({key_c});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async("a" SS_DELAY(100) "b");
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    // The matrix is still scanned and processed while the string waits
+    EXPECT_REPORT(driver, (KC_C));
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelReleasesHeldKeys) {
+    TestDriver driver;
+
+    send_string_async("AB");
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async_cancel();
+    EXPECT_FALSE(send_string_async_is_busy());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, CancelReleasesKeysHeldByEarlierCharacters) {
+    TestDriver driver;
+
+    InSequence s;
+
+    send_string_async(SS_DOWN(X_LCTL) "ab");
+
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_B));
+    idle_for(4);
+    VERIFY_AND_CLEAR(driver);
+
+    // The key being typed and the control held since the first character are both released
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_async_cancel();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringAsync, FullQueueRejectsString) {
+    TestDriver driver;
+
+    EXPECT_TRUE(send_string_async("0123456789012345678901234"));
+    EXPECT_FALSE(send_string_async("abcde"));
+    EXPECT_TRUE(send_string_async("ab"));
+
+    EXPECT_ANY_REPORT(driver).Times(2 * 27);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+}
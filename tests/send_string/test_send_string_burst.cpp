@@ -0,0 +1,135 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::Invoke;
+using testing::InSequence;
+
+/* Turns keyboard reports back into the characters a US host would type */
+class HostTyping {
+   public:
+    HostTyping() {
+        for (int c = 0x7F; c >= 0x08; c--) {
+            uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[c]);
+            bool    shifted = (pgm_read_byte(&ascii_to_shift_lut[c / 8]) >> (c % 8)) & 1;
+            if (keycode != KC_NO) m_chars[{keycode, shifted}] = (char)c;
+        }
+    }
+
+    void report(const report_keyboard_t &report) {
+        m_reports++;
+        std::vector<uint8_t> keys;
+        for (uint8_t key : report.keys) {
+            if (key == KC_NO) continue;
+            keys.push_back(key);
+            if (std::find(m_keys.begin(), m_keys.end(), key) == m_keys.end()) {
+                bool shifted = report.mods & (MOD_BIT(KC_LEFT_SHIFT) | MOD_BIT(KC_RIGHT_SHIFT));
+                m_typed += m_chars[{key, shifted}];
+            }
+        }
+        m_keys = keys;
+    }
+
+    std::string typed() const {
+        return m_typed;
+    }
+    size_t reports() const {
+        return m_reports;
+    }
+    bool released() const {
+        return m_keys.empty();
+    }
+
+   private:
+    std::map<std::pair<uint8_t, bool>, char> m_chars;
+    std::vector<uint8_t>                     m_keys;
+    std::string                              m_typed;
+    size_t                                   m_reports = 0;
+};
+
+class SendStringBurst : public TestFixture {
+   protected:
+    HostTyping type(TestDriver &driver, void (*send)(const char *), const char *string) {
+        HostTyping host;
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&host](report_keyboard_t &report) { host.report(report); }));
+        send(string);
+        testing::Mock::VerifyAndClearExpectations(&driver);
+        return host;
+    }
+};
+
+TEST_F(SendStringBurst, PressesNextKeyWhileReleasingThePreviousOne) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_burst("abc");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBurst, RepeatedKeysAreReleasedInBetween) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_burst("aa");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBurst, ModifierChangesReleaseThePreviousKeyFirst) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_burst("aBCd");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBurst, KeycodeSequencesEndTheBurst) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string_burst("a" SS_LCTL("c") "b");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBurst, HostSeesTheSameTextWithFewerReports) {
+    TestDriver  driver;
+    const char *text = "The quick brown fox jumps over the lazy dog.\nHello, World! (1 + 1 == 2) ~/.config <tab>\tdone";
+
+    HostTyping regular = type(driver, send_string, text);
+    HostTyping burst   = type(driver, send_string_burst, text);
+
+    EXPECT_EQ(regular.typed(), text);
+    EXPECT_EQ(burst.typed(), text);
+    EXPECT_TRUE(burst.released());
+    EXPECT_LE(burst.reports() * 10, regular.reports() * 6);
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// A large table of dances, the first 26 of which tap a letter, the others a digit
+#define DANCE(i) [i] = ACTION_TAP_DANCE_DOUBLE((i) < 26 ? KC_A + (i) : KC_1 + (i) % 10, KC_ESC)
+#define DANCE_4(i) DANCE(i), DANCE(i + 1), DANCE(i + 2), DANCE(i + 3)
+#define DANCE_16(i) DANCE_4(i), DANCE_4(i + 4), DANCE_4(i + 8), DANCE_4(i + 12)
+
+tap_dance_action_t tap_dance_actions[] = {DANCE_16(0), DANCE_16(16), DANCE_16(32), DANCE_16(48)};
+
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return keycode == TD(63) ? 2 * TAPPING_TERM : TAPPING_TERM;
+}
@@ -0,0 +1,6 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+TAP_DANCE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = tap_dance_pool_defs.c
@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class TapDancePool : public TestFixture {};
+
+TEST_F(TapDancePool, LastDanceOfLargeTable) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(62));
+
+    set_keymap({key_td});
+
+    tap_key(key_td);
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    /* Double tap */
+    tap_key(key_td);
+    EXPECT_NO_REPORT(driver);
+    key_td.press();
+    EXPECT_REPORT(driver, (KC_ESC));
+    run_one_scan_loop();
+    key_td.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDancePool, TimeoutUsesTappingTermOfDance) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_td = KeymapKey(0, 1, 0, TD(63));
+
+    set_keymap({key_td});
+
+    tap_key(key_td);
+    EXPECT_NO_REPORT(driver);
+    idle_for(2 * TAPPING_TERM - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDancePool, InterruptingDanceStartsItsOwn) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a  = KeymapKey(0, 1, 0, TD(0));
+    auto       key_td = KeymapKey(0, 2, 0, TD(40));
+
+    set_keymap({key_a, key_td});
+
+    tap_key(key_a);
+    EXPECT_NO_REPORT(driver);
+    VERIFY_AND_CLEAR(driver);
+
+    /* The second dance finishes the first one, then counts its own taps */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_td);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_ESC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_td);
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TapDancePool, MoreDancesHeldThanStates) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 1, 0, TD(0));
+    auto       key_b = KeymapKey(0, 2, 0, TD(1));
+    auto       key_c = KeymapKey(0, 3, 0, TD(2));
+    auto       key_d = KeymapKey(0, 4, 0, TD(3));
+
+    set_keymap({key_a, key_b, key_c, key_d});
+
+    /* Each dance is finished by the next one while held */
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (KC_A));
+    key_b.press();
+    run_one_scan_loop();
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    key_c.press();
+    run_one_scan_loop();
+
+    /* There is no state left for the fourth dance, so it does nothing */
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    key_d.press();
+    run_one_scan_loop();
+    key_d.release();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    key_c.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The states are free again */
+    tap_key(key_d);
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
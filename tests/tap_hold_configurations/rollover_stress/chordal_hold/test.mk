@@ -0,0 +1,6 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+include tests/test_common/rollover_stress.mk
+
+INTROSPECTION_KEYMAP_C = test_keymap.c
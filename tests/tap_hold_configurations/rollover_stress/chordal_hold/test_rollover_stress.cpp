@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+// A key of the same hand pressed while a home row mod is held makes it a tap, even past the tapping term
+TEST_F(RolloverStress, SameHandIsTapped) {
+    EXPECT_EQ(type_keys("agag").typed, "ag");
+    EXPECT_EQ(type_keys("agga", 120).typed, "ag");
+}
+
+TEST_F(RolloverStress, OppositeHandsAreHeldPastTappingTerm) {
+    EXPECT_EQ(type_keys("ahha").typed, "ah");
+    EXPECT_EQ(type_keys("ahha", 120).typed, "<G-h>");
+}
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    ChordalHold,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"chordal hold 150 wpm", {.wpm = 150, .overlap_percent = 50}},
+        RolloverStressCase{"chordal hold 200 wpm", {.wpm = 200, .overlap_percent = 90}}
+        ));
+// clang-format on
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+// Without options a home row mod is only held once the tapping term expires
+TEST_F(RolloverStress, RollsAndNestedTapsAreTapped) {
+    EXPECT_EQ(type_keys("agag").typed, "ag");
+    EXPECT_EQ(type_keys("agga").typed, "ag");
+    EXPECT_EQ(type_keys("ahha").typed, "ah");
+}
+
+TEST_F(RolloverStress, HeldPastTappingTermIsHeld) {
+    EXPECT_EQ(type_keys("agga", 120).typed, "<G-g>");
+}
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    Default,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"default 150 wpm", {.wpm = 150, .overlap_percent = 50}},
+        RolloverStressCase{"default 200 wpm", {.wpm = 200, .overlap_percent = 90}}
+        ));
+// clang-format on
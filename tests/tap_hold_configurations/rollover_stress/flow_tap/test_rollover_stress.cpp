@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+// Outside of a typing streak the permissive hold of this configuration applies
+TEST_F(RolloverStress, NestedTapIsHeldAfterPause) {
+    EXPECT_EQ(type_keys("agga").typed, "<G-g>");
+}
+
+// A home row mod pressed within the flow tap term of the previous key is tapped right away
+TEST_F(RolloverStress, NestedTapIsTappedWithinStreak) {
+    EXPECT_EQ(type_keys("gghhahha").typed, "ghah");
+}
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    FlowTap,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"flow tap 150 wpm", {.wpm = 150, .overlap_percent = 50}},
+        RolloverStressCase{"flow tap 200 wpm", {.wpm = 200, .overlap_percent = 90}}
+        ));
+// clang-format on
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+// Any key pressed while a home row mod is held makes it a hold, rolled or nested
+TEST_F(RolloverStress, RollsAreHeld) {
+    EXPECT_EQ(type_keys("agag").typed, "<G-g>");
+    EXPECT_EQ(type_keys("dhdh").typed, "<C-h>");
+    EXPECT_EQ(type_keys("agga").typed, "<G-g>");
+}
+
+TEST_F(RolloverStress, TapsAloneAreTapped) {
+    EXPECT_EQ(type_keys("aagg").typed, "ag");
+}
+
+// Rolls don't give the intended text, but no modifier may be left active once all keys are released
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    HoldOnOtherKeyPress,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"hold on other key press 150 wpm", {.wpm = 150, .overlap_percent = 50}, false}
+        ));
+// clang-format on
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+TEST_F(RolloverStress, RollsAreTapped) {
+    EXPECT_EQ(type_keys("agag").typed, "ag");
+    EXPECT_EQ(type_keys("ahah").typed, "ah");
+}
+
+// A key tapped while a home row mod is held makes it a hold, even within the tapping term
+TEST_F(RolloverStress, NestedTapsAreHeld) {
+    EXPECT_EQ(type_keys("agga").typed, "<G-g>");
+    EXPECT_EQ(type_keys("dhhd").typed, "<C-h>");
+}
+
+// Rolls never nest, so permissive hold must settle every home row mod as tapped
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    PermissiveHold,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"permissive hold 150 wpm", {.wpm = 150, .overlap_percent = 50}},
+        RolloverStressCase{"permissive hold 200 wpm", {.wpm = 200, .overlap_percent = 90}}
+        ));
+// clang-format on
@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+// Ctrl and shift mod-taps are reported as soon as they are pressed, and taken back once settled as tapped
+TEST_F(RolloverStress, CtrlIsHeldSpeculatively) {
+    RolloverResult result = type_keys("dgdg");
+    EXPECT_EQ(result.typed, "dg");
+    EXPECT_EQ(result.seen_mods, MOD_BIT(KC_LEFT_CTRL));
+    EXPECT_EQ(result.stuck_mods, 0);
+}
+
+TEST_F(RolloverStress, GuiIsNotHeldSpeculatively) {
+    RolloverResult result = type_keys("agag");
+    EXPECT_EQ(result.typed, "ag");
+    EXPECT_EQ(result.seen_mods, 0);
+}
+
+// clang-format off
+INSTANTIATE_TEST_CASE_P(
+    SpeculativeHold,
+    RolloverStressRandomText,
+    ::testing::Values(
+        RolloverStressCase{"speculative hold 150 wpm", {.wpm = 150, .overlap_percent = 50}},
+        RolloverStressCase{"speculative hold 200 wpm", {.wpm = 200, .overlap_percent = 90}}
+        ));
+// clang-format on
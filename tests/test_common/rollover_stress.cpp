@@ -0,0 +1,324 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rollover_stress.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "action_util.h"
+#include "keycode.h"
+#include "modifiers.h"
+}
+
+// Common English words, which give a realistic mix of same-hand and alternating-hand rolls
+static const char rollover_words[] =
+    "the of and to in is you that it he was for on are as with his they at be this have from or one had by word but not what all were we when your can said there "
+    "use an each which she do how their if will up other about out many then them these so some her would make like him into time has look two more write go see "
+    "number no way could people my than first water been call who oil its now find long down day did get come made may part sad fall ask glass flask";
+
+std::string random_typing_text(size_t words, uint32_t seed) {
+    std::vector<std::string> dictionary;
+    std::istringstream       split(rollover_words);
+    for (std::string word; split >> word;) {
+        dictionary.push_back(word);
+    }
+
+    std::mt19937                          generator(seed);
+    std::uniform_int_distribution<size_t> word(0, dictionary.size() - 1);
+    std::uniform_int_distribution<int>    capitalize(0, 9);
+    std::string                           text;
+
+    for (size_t i = 0; i < words; i++) {
+        std::string next = dictionary[word(generator)];
+        if (capitalize(generator) == 0) {
+            next[0] = next[0] - 'a' + 'A';
+        }
+        if (i > 0) {
+            text += ' ';
+        }
+        text += next;
+    }
+    return text;
+}
+
+KeyTrace synthesize_rollover_trace(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, const RolloverSettings& settings) {
+    std::mt19937                     generator(settings.seed);
+    std::uniform_real_distribution<> jitter(-(double)settings.jitter_percent / 100, (double)settings.jitter_percent / 100);
+    const double                     interval = 60000.0 / (settings.wpm * 5);
+    const double                     hold     = interval * (100 + settings.overlap_percent) / 100;
+
+    struct Stroke {
+        std::vector<keypos_t> keys; // modifiers first, the key itself last
+        uint32_t              press;
+        uint32_t              hold;
+    };
+    std::vector<Stroke> strokes;
+    uint32_t            time = 50;
+
+    for (char c : text) {
+        std::vector<keypos_t> keys = keys_for_char(c);
+        if (keys.empty()) {
+            continue;
+        }
+        // Leave room for the modifiers to go down after the previous key
+        uint32_t press = strokes.empty() ? time : std::max(time, strokes.back().press + 1 + 5 * (uint32_t)keys.size());
+        strokes.push_back({keys, press, (uint32_t)std::max(hold * (1 + jitter(generator)), 1.0)});
+        time = press + (uint32_t)std::max(interval * (1 + jitter(generator)), 10.0);
+    }
+
+    // Time at which the first key of a stroke goes down, the modifiers a little ahead of the key
+    auto first_press = [&](size_t index) { return strokes[index].press - 5 * (uint32_t)(strokes[index].keys.size() - 1); };
+
+    // Moves stroke `index` and all after it later, so that its first key goes down at `time` at the earliest
+    auto delay_from = [&](size_t index, uint32_t time) {
+        if (index < strokes.size() && first_press(index) < time) {
+            uint32_t delay = time - first_press(index);
+            for (size_t j = index; j < strokes.size(); j++) {
+                strokes[j].press += delay;
+            }
+        }
+    };
+
+    // A key has to be let go before it is pressed again by a later stroke
+    auto release_before_reuse = [&](size_t index, keypos_t key, uint32_t release) {
+        for (size_t j = index + 1; j < strokes.size(); j++) {
+            const std::vector<keypos_t>& keys = strokes[j].keys;
+            if (std::any_of(keys.begin(), keys.end(), [&](keypos_t other) { return KEYEQ(key, other); })) {
+                delay_from(j, release + 1);
+                return;
+            }
+        }
+    };
+
+    KeyTrace trace;
+    uint32_t previous_release = 0;
+    for (size_t i = 0; i < strokes.size(); i++) {
+        const Stroke&   stroke   = strokes[i];
+        const keypos_t& key      = stroke.keys.back();
+        const size_t    num_mods = stroke.keys.size() - 1;
+        const bool      has_next = i + 1 < strokes.size();
+
+        // Keys are released in the order they were pressed, each one after the next key went down, so rolls never nest
+        uint32_t release = std::max({stroke.press + stroke.hold, stroke.press + 1, previous_release + 1});
+        if (has_next && KEYEQ(key, strokes[i + 1].keys.back())) {
+            release = std::max(stroke.press + 1, previous_release + 1);
+        }
+
+        // Modifiers go down after the previous key and up once it is released, before the next key goes down
+        uint32_t mods_release = std::max(stroke.press + 1, previous_release + 1);
+        if (num_mods > 0) {
+            if (has_next) {
+                mods_release = std::max(mods_release, strokes[i + 1].press - 2);
+                delay_from(i + 1, mods_release + 2 + 5 * (uint32_t)(strokes[i + 1].keys.size() - 1));
+            }
+            for (size_t m = 0; m < num_mods; m++) {
+                release_before_reuse(i, stroke.keys[m], mods_release);
+            }
+        }
+
+        release_before_reuse(i, key, release);
+        if (has_next && !KEYEQ(key, strokes[i + 1].keys.back())) {
+            release = std::max(release, strokes[i + 1].press + 1);
+            release_before_reuse(i, key, release);
+        }
+
+        for (size_t m = 0; m < num_mods; m++) {
+            const keypos_t& mod = stroke.keys[m];
+            trace.push_back({stroke.press - (uint32_t)(num_mods - m) * 5, mod.col, mod.row, true});
+            trace.push_back({mods_release, mod.col, mod.row, false});
+        }
+        trace.push_back({stroke.press, key.col, key.row, true});
+        trace.push_back({release, key.col, key.row, false});
+        previous_release = release;
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return trace;
+}
+
+static char rollover_char_for_keycode(uint8_t keycode, bool shifted) {
+    if (keycode >= KC_A && keycode <= KC_Z) {
+        return (shifted ? 'A' : 'a') + (keycode - KC_A);
+    }
+    if (keycode >= KC_1 && keycode <= KC_0) {
+        return shifted ? "!@#$%^&*()"[keycode - KC_1] : "1234567890"[keycode - KC_1];
+    }
+    switch (keycode) {
+        case KC_SPACE:
+            return ' ';
+        case KC_ENTER:
+            return '\n';
+        case KC_QUOTE:
+            return shifted ? '"' : '\'';
+        case KC_COMMA:
+            return shifted ? '<' : ',';
+        case KC_DOT:
+            return shifted ? '>' : '.';
+        case KC_SLASH:
+            return shifted ? '?' : '/';
+        case KC_SEMICOLON:
+            return shifted ? ':' : ';';
+        case KC_MINUS:
+            return shifted ? '_' : '-';
+        default:
+            return '?';
+    }
+}
+
+// Appends the keys that went down in `report` to the text
+static void decode_report(const report_keyboard_t& report, const report_keyboard_t& previous, std::string& typed) {
+    const bool    shifted = report.mods & MOD_MASK_SHIFT;
+    const uint8_t others  = report.mods & ~MOD_MASK_SHIFT;
+
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t keycode = report.keys[i];
+        if (keycode == KC_NO || std::find(std::begin(previous.keys), std::end(previous.keys), keycode) != std::end(previous.keys)) {
+            continue;
+        }
+
+        if (others) {
+            typed += '<';
+            typed += (others & MOD_MASK_CTRL) ? "C" : "";
+            typed += (others & MOD_MASK_ALT) ? "A" : "";
+            typed += (others & MOD_MASK_GUI) ? "G" : "";
+            typed += '-';
+        }
+        typed += rollover_char_for_keycode(keycode, shifted);
+        if (others) {
+            typed += '>';
+        }
+    }
+}
+
+double RolloverResult::engine_ns_per_event() const {
+    return timing.events ? (double)timing.action_exec.count() / timing.events : 0;
+}
+
+// Replays `trace`, decodes the keyboard reports back into text, and checks what is left registered afterwards
+static RolloverResult replay_rollover_trace(const KeyTrace& trace) {
+    RolloverResult    result   = {};
+    report_keyboard_t previous = {};
+
+    result.timing = replay_key_trace(trace, [&](const report_keyboard_t& report) {
+        decode_report(report, previous, result.typed);
+        result.seen_mods |= report.mods;
+        previous = report;
+    });
+
+    result.stuck_mods = get_mods() | get_weak_mods() | get_oneshot_mods();
+    result.stuck_keys = previous.mods != 0 || std::any_of(std::begin(previous.keys), std::end(previous.keys), [](uint8_t keycode) { return keycode != KC_NO; });
+    return result;
+}
+
+RolloverResult run_rollover_stress(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, const RolloverSettings& settings) {
+    return replay_rollover_trace(synthesize_rollover_trace(text, keys_for_char, settings));
+}
+
+void report_rollover_stress(const std::string& name, const std::string& text, const RolloverResult& result, bool expect_text) {
+    EXPECT_EQ(result.stuck_mods, 0) << name << " left modifiers active";
+    EXPECT_FALSE(result.stuck_keys) << name << " left keys in the last keyboard report";
+    if (expect_text) {
+        EXPECT_EQ(result.typed, text) << name << " typed the wrong text";
+    }
+
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(0);
+    summary << name << ": " << result.timing.events << " events, " << result.engine_ns_per_event() << " ns of action_exec per event" << std::endl;
+    std::cout << summary.str();
+
+    testing::Test::RecordProperty("events", std::to_string(result.timing.events));
+    testing::Test::RecordProperty("engine_ns_per_event", std::to_string((uint64_t)result.engine_ns_per_event()));
+}
+
+static const char* const rollover_rows[] = {"qwertyuiop", "asdfghjkl;", "zxcvbnm,./"};
+
+enum rollover_row3_cols { ROLLOVER_LSFT, ROLLOVER_SPC };
+
+uint16_t rollover_keycode(uint8_t col, uint8_t row) {
+    static const uint16_t home_row[] = {LGUI_T(KC_A), LALT_T(KC_S), LCTL_T(KC_D), LSFT_T(KC_F), KC_G, KC_H, RSFT_T(KC_J), RCTL_T(KC_K), LALT_T(KC_L), RGUI_T(KC_SCLN)};
+    switch (row) {
+        case 1:
+            return home_row[col];
+        case 3:
+            return col == ROLLOVER_LSFT ? KC_LSFT : col == ROLLOVER_SPC ? KC_SPC : KC_NO;
+    }
+    switch (char c = rollover_rows[row][col]) {
+        case ',':
+            return KC_COMM;
+        case '.':
+            return KC_DOT;
+        case '/':
+            return KC_SLSH;
+        default:
+            return KC_A + (c - 'a');
+    }
+}
+
+std::vector<keypos_t> rollover_keys_for_char(char c) {
+    bool shifted = false;
+    if (c >= 'A' && c <= 'Z') {
+        c       = c - 'A' + 'a';
+        shifted = true;
+    }
+    if (c == ' ') {
+        return {{.col = ROLLOVER_SPC, .row = 3}};
+    }
+    for (uint8_t row = 0; row < 3; row++) {
+        if (const char* col = std::strchr(rollover_rows[row], c)) {
+            keypos_t key = {.col = (uint8_t)(col - rollover_rows[row]), .row = row};
+            if (shifted) {
+                return {{.col = ROLLOVER_LSFT, .row = 3}, key};
+            }
+            return {key};
+        }
+    }
+    return {};
+}
+
+void RolloverStress::SetUp() {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            add_key(KeymapKey(0, col, row, rollover_keycode(col, row)));
+        }
+    }
+}
+
+RolloverResult RolloverStress::type_keys(const std::string& toggles, uint32_t interval) {
+    KeyTrace    trace;
+    std::string held;
+    uint32_t    time = 50;
+
+    for (char c : toggles) {
+        keypos_t key     = rollover_keys_for_char(c).back();
+        bool     pressed = held.find(c) == std::string::npos;
+        if (pressed) {
+            held += c;
+        } else {
+            held.erase(held.find(c), 1);
+        }
+        trace.push_back({time, key.col, key.row, pressed});
+        time += interval;
+    }
+    return replay_rollover_trace(trace);
+}
+
+std::ostream& operator<<(std::ostream& os, const RolloverStressCase& test_case) {
+    return os << test_case.name;
+}
+
+TEST_P(RolloverStressRandomText, TypesRandomText) {
+    RolloverStressCase test_case = GetParam();
+    for (uint32_t seed = 1; seed <= 4; seed++) {
+        test_case.settings.seed = seed;
+        std::string    text     = random_typing_text(200, seed);
+        RolloverResult result   = run_rollover_stress(text, rollover_keys_for_char, test_case.settings);
+        report_rollover_stress(test_case.name + " seed " + std::to_string(seed), text, result, test_case.expect_text);
+    }
+}
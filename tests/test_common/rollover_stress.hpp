@@ -0,0 +1,107 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <ostream>
+#include <vector>
+#include "test_common.hpp"
+#include "trace_benchmark.hpp"
+
+/**
+ * @brief How fast and how overlapped the synthesized typist rolls from key to key.
+ */
+struct RolloverSettings {
+    unsigned wpm             = 150; // words of five characters per minute
+    unsigned overlap_percent = 50;  // how long each key stays down after the next one is pressed, in percent of the interval
+    unsigned jitter_percent  = 20;  // random variation of intervals and hold times
+    uint32_t seed            = 1;
+};
+
+/**
+ * @brief Generates `words` words of random text, drawn from common English words, some of them capitalized.
+ */
+std::string random_typing_text(size_t words, uint32_t seed);
+
+/**
+ * @brief Synthesizes a trace of a typist rolling through `text` at the given speed and overlap.
+ *
+ * Each key is released after the next one is pressed, but before that one is released, so rolls never
+ * nest. Modifiers returned by `keys_for_char` ahead of the key are pressed just before it and released
+ * just before the next key goes down, so they never apply to a neighbouring character.
+ *
+ * @param keys_for_char the keys to hold for a character, e.g. {shift, a} for 'A'; empty to skip it
+ */
+KeyTrace synthesize_rollover_trace(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, const RolloverSettings& settings);
+
+struct RolloverResult {
+    std::string          typed;       // the text the host saw, modifiers other than shift as e.g. "<C-a>"
+    uint8_t              seen_mods;   // every modifier any keyboard report carried, even without a key
+    uint8_t              stuck_mods;  // modifiers still active after every key was released
+    bool                 stuck_keys;  // whether the last keyboard report still holds any key
+    TraceBenchmarkResult timing;
+
+    double engine_ns_per_event() const;
+};
+
+/**
+ * @brief Types `text` with the given settings, decodes the keyboard reports back into text, and checks that
+ * nothing is left registered afterwards.
+ */
+RolloverResult run_rollover_stress(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, const RolloverSettings& settings);
+
+/**
+ * @brief Checks the invariants of a rollover run, prints its engine time per event and records it as test properties.
+ *
+ * @param expect_text whether the typed text must equal `text`, which only holds for settings that the tapping
+ * configuration under test resolves every roll as taps for
+ */
+void report_rollover_stress(const std::string& name, const std::string& text, const RolloverResult& result, bool expect_text = true);
+
+/**
+ * @brief Keycode of the rollover layout at a position, KC_NO where there is no key.
+ *
+ * Three rows of a staggered layout with home row mods, GUI, Alt, Ctrl and Shift from the outside in,
+ * and shift and space on the fourth.
+ */
+uint16_t rollover_keycode(uint8_t col, uint8_t row);
+
+/**
+ * @brief The keys of the rollover layout to hold for a character, empty if it has none.
+ */
+std::vector<keypos_t> rollover_keys_for_char(char c);
+
+class RolloverStress : public TestFixture {
+   public:
+    void SetUp() override;
+
+    /**
+     * @brief Types `toggles` on the rollover layout, `interval` milliseconds apart, where the first
+     * occurrence of a character presses its key and the second one releases it.
+     *
+     * Example: `type_keys("agag")` rolls from a to g, `type_keys("agga")` taps g while a is held.
+     */
+    RolloverResult type_keys(const std::string& toggles, uint32_t interval = 20);
+};
+
+/**
+ * @brief One run of random text through a tapping configuration.
+ */
+struct RolloverStressCase {
+    std::string      name;
+    RolloverSettings settings;
+    bool             expect_text = true; // whether the configuration resolves every roll of these settings as taps
+};
+
+std::ostream& operator<<(std::ostream& os, const RolloverStressCase& test_case);
+
+/**
+ * @brief Types random text with four seeds per case and checks the invariants of report_rollover_stress().
+ *
+ * Instantiate it with the cases of the configuration under test, e.g.
+ * `INSTANTIATE_TEST_CASE_P(PermissiveHold, RolloverStressRandomText, ::testing::Values(...))`.
+ */
+class RolloverStressRandomText : public RolloverStress, public ::testing::WithParamInterface<RolloverStressCase> {};
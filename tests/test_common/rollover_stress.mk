@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Include from the test.mk of a rollover stress test to link the typing-stream generator and the shared
+# RolloverStressRandomText test, which the test instantiates with the settings of its configuration.
+# The engine time per event is measured by the trace replay harness.
+
+include tests/test_common/trace_benchmark.mk
+
+SRC += tests/test_common/rollover_stress.cpp
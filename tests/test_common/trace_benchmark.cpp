@@ -0,0 +1,233 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "trace_benchmark.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "action.h"
+#include "host.h"
+#include "timer.h"
+#include "test_matrix.h"
+void advance_time(uint32_t ms);
+}
+
+using benchmark_clock = std::chrono::steady_clock;
+
+static TraceBenchmarkResult*                         current_result = nullptr;
+static std::function<void(const report_keyboard_t&)> current_on_report;
+
+/* Stages are timed by wrapping the functions at their boundaries with -Wl,--wrap, see trace_benchmark.mk.
+ * Only the outermost call of a stage is timed, as some of them are re-entered, e.g. by combos. */
+class StageTimer {
+   public:
+    StageTimer(std::chrono::nanoseconds TraceBenchmarkResult::*stage, unsigned& depth) : m_stage(stage), m_depth(depth) {
+        if (current_result && m_depth++ == 0) {
+            m_start = benchmark_clock::now();
+        }
+    }
+    ~StageTimer() {
+        if (current_result && --m_depth == 0) {
+            current_result->*m_stage += benchmark_clock::now() - m_start;
+        }
+    }
+
+   private:
+    std::chrono::nanoseconds TraceBenchmarkResult::*m_stage;
+    unsigned&                                        m_depth;
+    benchmark_clock::time_point                      m_start;
+};
+
+static unsigned action_exec_depth        = 0;
+static unsigned pre_process_record_depth = 0;
+static unsigned host_send_depth          = 0;
+
+extern "C" {
+void __real_action_exec(keyevent_t event);
+bool __real_pre_process_record_quantum(keyrecord_t* record);
+void __real_host_keyboard_send(report_keyboard_t* report);
+
+void __wrap_action_exec(keyevent_t event) {
+    StageTimer timer(&TraceBenchmarkResult::action_exec, action_exec_depth);
+    __real_action_exec(event);
+}
+
+bool __wrap_pre_process_record_quantum(keyrecord_t* record) {
+    StageTimer timer(&TraceBenchmarkResult::pre_process_record, pre_process_record_depth);
+    return __real_pre_process_record_quantum(record);
+}
+
+void __wrap_host_keyboard_send(report_keyboard_t* report) {
+    StageTimer timer(&TraceBenchmarkResult::host_send, host_send_depth);
+    __real_host_keyboard_send(report);
+}
+}
+
+static uint8_t benchmark_keyboard_leds(void) {
+    return 0;
+}
+
+static void benchmark_send_keyboard(report_keyboard_t* report) {
+    if (current_result) {
+        current_result->keyboard_reports++;
+    }
+    if (current_on_report) {
+        current_on_report(*report);
+    }
+}
+
+static void benchmark_send_nkro(report_nkro_t* report) {}
+static void benchmark_send_mouse(report_mouse_t* report) {}
+static void benchmark_send_extra(report_extra_t* report) {}
+
+static host_driver_t benchmark_driver = {benchmark_keyboard_leds, benchmark_send_keyboard, benchmark_send_nkro, benchmark_send_mouse, benchmark_send_extra};
+
+KeyTrace load_key_trace(const std::string& path) {
+    KeyTrace      trace;
+    std::ifstream file(path);
+    std::string   line;
+    unsigned      line_number = 0;
+
+    if (!file) {
+        ADD_FAILURE() << "could not open trace " << path;
+        return trace;
+    }
+
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           col, row;
+        char               edge;
+        if (!(fields >> time >> col >> row >> edge) || (edge != 'd' && edge != 'u') || col >= MATRIX_COLS || row >= MATRIX_ROWS) {
+            ADD_FAILURE() << path << ":" << line_number << ": invalid trace event \"" << line << "\"";
+            continue;
+        }
+        trace.push_back({time, (uint8_t)col, (uint8_t)row, edge == 'd'});
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return trace;
+}
+
+KeyTrace synthesize_key_trace(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, uint32_t seed) {
+    std::mt19937                            generator(seed);
+    std::uniform_int_distribution<uint32_t> interval(40, 180); // from one key press to the next
+    std::uniform_int_distribution<uint32_t> hold(50, 110);     // from press to release, often past the next press
+    KeyTrace                                trace;
+    uint32_t                                time = 0;
+
+    for (char c : text) {
+        std::vector<keypos_t> keys = keys_for_char(c);
+        if (keys.empty()) {
+            continue;
+        }
+
+        // Modifiers are pressed first and released last, with a short gap to the key itself
+        uint32_t press = time;
+        for (size_t i = 0; i < keys.size(); i++) {
+            trace.push_back({press, keys[i].col, keys[i].row, true});
+            press += (i + 1 < keys.size()) ? 20 : 0;
+        }
+        uint32_t release = press + hold(generator);
+        for (size_t i = keys.size(); i > 0; i--) {
+            trace.push_back({release, keys[i - 1].col, keys[i - 1].row, false});
+            release += 15;
+        }
+
+        time = press + interval(generator);
+    }
+
+    std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    return trace;
+}
+
+double TraceBenchmarkResult::events_per_second() const {
+    auto seconds = std::chrono::duration<double>(total()).count();
+    return seconds > 0 ? events / seconds : 0;
+}
+
+static void benchmark_scan_loop(TraceBenchmarkResult& result) {
+    auto start = benchmark_clock::now();
+    keyboard_task();
+    auto scanned = benchmark_clock::now();
+    housekeeping_task();
+    result.keyboard_task += scanned - start;
+    result.housekeeping += benchmark_clock::now() - scanned;
+    result.scan_loops++;
+    advance_time(1);
+}
+
+TraceBenchmarkResult replay_key_trace(const KeyTrace& trace, const std::function<void(const report_keyboard_t&)>& on_report) {
+    TraceBenchmarkResult result;
+    host_driver_t*       previous_driver = host_get_driver();
+    uint32_t             start           = timer_read32();
+
+    host_set_driver(&benchmark_driver);
+    current_result    = &result;
+    current_on_report = on_report;
+
+    for (const TraceEvent& event : trace) {
+        while (TIMER_DIFF_32(timer_read32(), start) < event.time) {
+            benchmark_scan_loop(result);
+        }
+        if (event.pressed) {
+            press_key(event.col, event.row);
+        } else {
+            release_key(event.col, event.row);
+        }
+        result.events++;
+    }
+
+    // Let tapping, combos and tap dances time out, so that the last events are processed as well
+    for (unsigned i = 0; i < 1000; i++) {
+        benchmark_scan_loop(result);
+    }
+
+    current_result    = nullptr;
+    current_on_report = nullptr;
+    host_set_driver(previous_driver);
+    return result;
+}
+
+static double milliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void report_trace_benchmark(const std::string& name, const TraceBenchmarkResult& result) {
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(2);
+    summary << name << ": " << result.events << " events, " << result.scan_loops << " scan loops, " << result.keyboard_reports << " keyboard reports in " << milliseconds(result.total()) << " ms" << std::endl;
+    summary << "  events/s:           " << std::setprecision(0) << result.events_per_second() << std::setprecision(2) << std::endl;
+    summary << "  keyboard_task:      " << milliseconds(result.keyboard_task) << " ms" << std::endl;
+    summary << "    action_exec:      " << milliseconds(result.action_exec) << " ms" << std::endl;
+    summary << "      pre_process:    " << milliseconds(result.pre_process_record) << " ms" << std::endl;
+    summary << "      host send:      " << milliseconds(result.host_send) << " ms" << std::endl;
+    summary << "  housekeeping_task:  " << milliseconds(result.housekeeping) << " ms" << std::endl;
+    std::cout << summary.str();
+
+    testing::Test::RecordProperty("events", std::to_string(result.events));
+    testing::Test::RecordProperty("events_per_second", std::to_string((uint64_t)result.events_per_second()));
+    testing::Test::RecordProperty("keyboard_task_ns", std::to_string(result.keyboard_task.count()));
+    testing::Test::RecordProperty("action_exec_ns", std::to_string(result.action_exec.count()));
+    testing::Test::RecordProperty("pre_process_record_ns", std::to_string(result.pre_process_record.count()));
+    testing::Test::RecordProperty("host_send_ns", std::to_string(result.host_send.count()));
+    testing::Test::RecordProperty("housekeeping_ns", std::to_string(result.housekeeping.count()));
+
+    // Host timings vary too much for a fixed bound, so a threshold is only checked when asked for
+    if (const char* minimum = std::getenv("QMK_BENCHMARK_MIN_EVENTS_PER_SECOND")) {
+        EXPECT_GE(result.events_per_second(), std::strtod(minimum, nullptr)) << name << " is slower than QMK_BENCHMARK_MIN_EVENTS_PER_SECOND";
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "keyboard.h"
+#include "report.h"
+}
+
+/**
+ * @brief One edge of a recorded key-event trace.
+ */
+struct TraceEvent {
+    uint32_t time; // milliseconds since the start of the trace
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+using KeyTrace = std::vector<TraceEvent>;
+
+/**
+ * @brief Loads a recorded trace, one event per line as `<time ms> <col> <row> <d|u>`.
+ * Blank lines and lines starting with '#' are ignored.
+ */
+KeyTrace load_key_trace(const std::string& path);
+
+/**
+ * @brief Synthesizes a trace of a typist entering `text`, with overlapping key presses.
+ *
+ * @param keys_for_char the keys to hold for a character, e.g. {shift, a} for 'A'; empty to skip it
+ * @param seed seed of the timing jitter, so that the same text always gives the same trace
+ */
+KeyTrace synthesize_key_trace(const std::string& text, const std::function<std::vector<keypos_t>(char)>& keys_for_char, uint32_t seed = 1);
+
+struct TraceBenchmarkResult {
+    size_t   events           = 0;
+    uint32_t scan_loops       = 0;
+    uint32_t keyboard_reports = 0;
+
+    // Time spent in each stage, nested stages are included in the ones that call them
+    std::chrono::nanoseconds keyboard_task{0};      // matrix scan, event generation and everything below
+    std::chrono::nanoseconds action_exec{0};        // tapping, combos, process_record and report generation
+    std::chrono::nanoseconds pre_process_record{0}; // combos and other features that see events first
+    std::chrono::nanoseconds host_send{0};          // handing keyboard reports to the host driver
+    std::chrono::nanoseconds housekeeping{0};
+
+    std::chrono::nanoseconds total() const {
+        return keyboard_task + housekeeping;
+    }
+    double events_per_second() const;
+};
+
+/**
+ * @brief Replays `trace` through the matrix, keyboard_task() and housekeeping_task(), one scan loop per
+ * millisecond of trace time, and measures how long each stage of the pipeline takes.
+ *
+ * Reports are sent to a counting host driver instead of the mocked TestDriver, so that gmock does not
+ * dominate the measurement.
+ *
+ * @param on_report called with every keyboard report sent to the host, e.g. to check the typed text
+ */
+TraceBenchmarkResult replay_key_trace(const KeyTrace& trace, const std::function<void(const report_keyboard_t&)>& on_report = nullptr);
+
+/**
+ * @brief Prints the result and records it as test properties.
+ *
+ * Fails the current test if the environment variable QMK_BENCHMARK_MIN_EVENTS_PER_SECOND is set and
+ * the result is below it.
+ */
+void report_trace_benchmark(const std::string& name, const TraceBenchmarkResult& result);
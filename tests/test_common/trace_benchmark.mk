@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Include from the test.mk of a benchmark test to link the trace replay harness.
+# The stages of the pipeline are timed by wrapping the functions at their boundaries.
+
+SRC += tests/test_common/trace_benchmark.cpp
+
+LDFLAGS += \
+	-Wl,--wrap=action_exec \
+	-Wl,--wrap=pre_process_record_quantum \
+	-Wl,--wrap=host_keyboard_send
@@ -0,0 +1,89 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+#define SYMS_10(prefix)                \
+    UCIS_SYM(prefix "0", 0x1F600), \
+    UCIS_SYM(prefix "1", 0x1F600), \
+    UCIS_SYM(prefix "2", 0x1F600), \
+    UCIS_SYM(prefix "3", 0x1F600), \
+    UCIS_SYM(prefix "4", 0x1F600), \
+    UCIS_SYM(prefix "5", 0x1F600), \
+    UCIS_SYM(prefix "6", 0x1F600), \
+    UCIS_SYM(prefix "7", 0x1F600), \
+    UCIS_SYM(prefix "8", 0x1F600), \
+    UCIS_SYM(prefix "9", 0x1F600)
+#define SYMS_100(prefix) SYMS_10(prefix "0"), SYMS_10(prefix "1"), SYMS_10(prefix "2"), SYMS_10(prefix "3"), SYMS_10(prefix "4"), SYMS_10(prefix "5"), SYMS_10(prefix "6"), SYMS_10(prefix "7"), SYMS_10(prefix "8"), SYMS_10(prefix "9")
+
+// More entries than fit in a uint8_t, sorted by mnemonic
+// clang-format off
+const ucis_symbol_t ucis_symbol_table[] = UCIS_TABLE(
+    SYMS_100("x0"),
+    SYMS_100("x1"),
+    SYMS_100("x2"),
+    UCIS_SYM("zmk", 0x03A8) // Ψ
+);
+// clang-format on
+
+class UnicodeUCISLarge : public TestFixture {};
+
+TEST_F(UnicodeUCISLarge, matches_entry_beyond_255) {
+    TestDriver driver;
+
+    auto key_z     = KeymapKey(0, 0, 0, KC_Z);
+    auto key_m     = KeymapKey(0, 1, 0, KC_M);
+    auto key_k     = KeymapKey(0, 2, 0, KC_K);
+    auto key_enter = KeymapKey(0, 3, 0, KC_ENTER);
+
+    set_keymap({key_z, key_m, key_k, key_enter});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_Z));
+    EXPECT_REPORT(driver, (KC_M));
+    EXPECT_REPORT(driver, (KC_K));
+    EXPECT_EMPTY_REPORT(driver).Times(3);
+    tap_keys(key_z, key_m, key_k);
+    EXPECT_EQ(ucis_count(), 3);
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE)).Times(4);
+    EXPECT_EMPTY_REPORT(driver).Times(4);
+    EXPECT_UNICODE(driver, 0x03A8);
+    tap_key(key_enter);
+
+    EXPECT_EQ(ucis_active(), false);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeUCISLarge, rejects_prefix_beyond_last_entry) {
+    TestDriver driver;
+
+    auto key_x = KeymapKey(0, 0, 0, KC_X);
+    auto key_3 = KeymapKey(0, 1, 0, KC_3);
+
+    set_keymap({key_x, key_3});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_key(key_x);
+    EXPECT_TRUE(ucis_prefix_matches());
+    tap_key(key_3);
+    EXPECT_FALSE(ucis_prefix_matches());
+
+    ucis_cancel();
+
+    VERIFY_AND_CLEAR(driver);
+}
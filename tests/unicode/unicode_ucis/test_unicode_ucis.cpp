@@ -10,7 +10,11 @@ using testing::_;
 
 // clang-format off
 const ucis_symbol_t ucis_symbol_table[] = UCIS_TABLE(
-    UCIS_SYM("qmk", 0x03A8) // Ψ
+    UCIS_SYM("look", 0x1F440),   // 👀
+    UCIS_SYM("lookup", 0x1F50D), // 🔍
+    UCIS_SYM("poop", 0x1F4A9),   // 💩
+    UCIS_SYM("qmk", 0x03A8),     // Ψ
+    UCIS_SYM("qmkb", 0x2328)     // ⌨
 );
 // clang-format on
 
@@ -219,3 +223,109 @@ TEST_F(UnicodeUCIS, does_not_match_shorter_sequence) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(UnicodeUCIS, matches_mnemonic_that_prefixes_another) {
+    TestDriver driver;
+
+    auto key_l     = KeymapKey(0, 0, 0, KC_L);
+    auto key_o     = KeymapKey(0, 1, 0, KC_O);
+    auto key_k     = KeymapKey(0, 2, 0, KC_K);
+    auto key_enter = KeymapKey(0, 3, 0, KC_ENTER);
+
+    set_keymap({key_l, key_o, key_k, key_enter});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_L));
+    EXPECT_REPORT(driver, (KC_O)).Times(2);
+    EXPECT_REPORT(driver, (KC_K));
+    EXPECT_EMPTY_REPORT(driver).Times(4);
+    tap_keys(key_l, key_o, key_o, key_k);
+    EXPECT_EQ(ucis_count(), 4);
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE)).Times(5);
+    EXPECT_EMPTY_REPORT(driver).Times(5);
+    EXPECT_UNICODE(driver, 0x1F440);
+    tap_key(key_enter);
+
+    EXPECT_EQ(ucis_active(), false);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeUCIS, matches_mnemonic_with_shared_prefix) {
+    TestDriver driver;
+
+    auto key_l     = KeymapKey(0, 0, 0, KC_L);
+    auto key_o     = KeymapKey(0, 1, 0, KC_O);
+    auto key_k     = KeymapKey(0, 2, 0, KC_K);
+    auto key_u     = KeymapKey(0, 3, 0, KC_U);
+    auto key_p     = KeymapKey(0, 4, 0, KC_P);
+    auto key_enter = KeymapKey(0, 5, 0, KC_ENTER);
+
+    set_keymap({key_l, key_o, key_k, key_u, key_p, key_enter});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_L));
+    EXPECT_REPORT(driver, (KC_O)).Times(2);
+    EXPECT_REPORT(driver, (KC_K));
+    EXPECT_REPORT(driver, (KC_U));
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver).Times(6);
+    tap_keys(key_l, key_o, key_o, key_k, key_u, key_p);
+    EXPECT_EQ(ucis_count(), 6);
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE)).Times(7);
+    EXPECT_EMPTY_REPORT(driver).Times(7);
+    EXPECT_UNICODE(driver, 0x1F50D);
+    tap_key(key_enter);
+
+    EXPECT_EQ(ucis_active(), false);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeUCIS, rejects_prefix_while_typing) {
+    TestDriver driver;
+
+    auto key_q         = KeymapKey(0, 0, 0, KC_Q);
+    auto key_m         = KeymapKey(0, 1, 0, KC_M);
+    auto key_x         = KeymapKey(0, 2, 0, KC_X);
+    auto key_k         = KeymapKey(0, 3, 0, KC_K);
+    auto key_backspace = KeymapKey(0, 4, 0, KC_BACKSPACE);
+
+    set_keymap({key_q, key_m, key_x, key_k, key_backspace});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_REPORT(driver, (KC_M));
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_keys(key_q, key_m);
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_X));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_x);
+    EXPECT_FALSE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_backspace);
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_K)).Times(2);
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_keys(key_k, key_k);
+    EXPECT_FALSE(ucis_prefix_matches());
+
+    ucis_cancel();
+
+    VERIFY_AND_CLEAR(driver);
+}
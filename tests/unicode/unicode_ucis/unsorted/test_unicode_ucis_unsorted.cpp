@@ -0,0 +1,78 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+// Not sorted by mnemonic, so lookups fall back to scanning the whole table
+// clang-format off
+const ucis_symbol_t ucis_symbol_table[] = UCIS_TABLE(
+    UCIS_SYM("qmk", 0x03A8),   // Ψ
+    UCIS_SYM("poop", 0x1F4A9), // 💩
+    UCIS_SYM("qm", 0x1F440)    // 👀
+);
+// clang-format on
+
+class UnicodeUCISUnsorted : public TestFixture {};
+
+TEST_F(UnicodeUCISUnsorted, matches_sequence) {
+    TestDriver driver;
+
+    auto key_q     = KeymapKey(0, 0, 0, KC_Q);
+    auto key_m     = KeymapKey(0, 1, 0, KC_M);
+    auto key_enter = KeymapKey(0, 2, 0, KC_ENTER);
+
+    set_keymap({key_q, key_m, key_enter});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_REPORT(driver, (KC_M));
+    EXPECT_EMPTY_REPORT(driver).Times(2);
+    tap_keys(key_q, key_m);
+    EXPECT_EQ(ucis_count(), 2);
+
+    EXPECT_REPORT(driver, (KC_BACKSPACE)).Times(3);
+    EXPECT_EMPTY_REPORT(driver).Times(3);
+    EXPECT_UNICODE(driver, 0x1F440);
+    tap_key(key_enter);
+
+    EXPECT_EQ(ucis_active(), false);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(UnicodeUCISUnsorted, rejects_prefix_while_typing) {
+    TestDriver driver;
+
+    auto key_p     = KeymapKey(0, 0, 0, KC_P);
+    auto key_q     = KeymapKey(0, 1, 0, KC_Q);
+    auto key_enter = KeymapKey(0, 2, 0, KC_ENTER);
+
+    set_keymap({key_p, key_q, key_enter});
+
+    EXPECT_UNICODE(driver, 0x2328); // ⌨
+    ucis_start();
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_p);
+    EXPECT_TRUE(ucis_prefix_matches());
+
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_q);
+    EXPECT_FALSE(ucis_prefix_matches());
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_enter);
+
+    EXPECT_EQ(ucis_active(), false);
+
+    VERIFY_AND_CLEAR(driver);
+}
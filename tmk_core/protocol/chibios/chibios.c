@@ -77,6 +77,10 @@ host_driver_t chibios_driver = {
 #endif
 };
 
+#ifdef MIDI_ENABLE
+void midi_ep_task(void);
+#endif
+
 #ifdef VIRTSER_ENABLE
 void virtser_task(void);
 #endif
@@ -203,6 +207,9 @@ void protocol_pre_task(void) {
 }
 
 void protocol_post_task(void) {
+#ifdef MIDI_ENABLE
+    midi_ep_task();
+#endif
 #ifdef VIRTSER_ENABLE
     virtser_task();
 #endif
@@ -12,10 +12,32 @@
 #include "usb_driver.h"
 #include "util.h"
 
+#ifdef HOST_REPORT_SCHEDULER
+#    include "host.h"
+#endif
+
 /*===========================================================================*/
 /* Driver local functions.                                                   */
 /*===========================================================================*/
 
+#ifdef HOST_REPORT_SCHEDULER
+/* Only endpoints carrying reports that the host report scheduler holds back
+ * tell it when those reports will be picked up. Other interrupt endpoints,
+ * e.g. raw HID or console, may be polled at an entirely different rate. */
+static bool is_host_report_scheduled_endpoint(usbep_t ep) {
+#    ifdef MOUSE_ENABLE
+    if (ep == MOUSE_IN_EPNUM) return true;
+#    endif
+#    ifdef EXTRAKEY_ENABLE
+    if (ep == SHARED_IN_EPNUM) return true;
+#    endif
+#    ifdef JOYSTICK_ENABLE
+    if (ep == JOYSTICK_IN_EPNUM) return true;
+#    endif
+    return false;
+}
+#endif
+
 static void usb_start_receive(usb_endpoint_out_t *endpoint) {
     /* If the USB driver is not in the appropriate state then transactions
        must not be started.*/
@@ -211,6 +233,14 @@ void usb_endpoint_in_tx_complete_cb(USBDriver *usbp, usbep_t ep) {
     /* Checking if there is a buffer ready for transmission.*/
     buffer = obqGetFullBufferI(&endpoint->obqueue, &n);
 
+#ifdef HOST_REPORT_SCHEDULER
+    /* Interrupt endpoints complete on host polls, which lets the host report
+     * scheduler learn the poll interval and phase. */
+    if (usbp->epc[ep]->ep_mode == USB_EP_MODE_TYPE_INTR && is_host_report_scheduled_endpoint(ep)) {
+        host_report_serviced(ep, buffer != NULL);
+    }
+#endif
+
     if (buffer != NULL) {
         /* The endpoint cannot be busy, we are in the context of the callback,
            so it is safe to transmit without a check.*/
@@ -525,14 +525,29 @@ void raw_hid_task(void) {
 
 #ifdef MIDI_ENABLE
 
+/**
+ * @brief Queue a MIDI event packet. Packets are collected into one transfer
+ * of up to the endpoint size, which is sent once it is full or when
+ * `midi_ep_task` flushes it at the end of the main loop iteration, so a chord
+ * or a burst of control changes goes out as a single transfer.
+ */
 void send_midi_packet(MIDI_EventPacket_t *event) {
-    send_report(USB_ENDPOINT_IN_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
+    send_report_buffered(USB_ENDPOINT_IN_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+/**
+ * @brief Take the next MIDI event packet from the received transfers. Each
+ * transfer holds up to an endpoint size worth of packets, which are read one
+ * after the other from the buffer queue without waiting for the host.
+ */
 bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return receive_report(USB_ENDPOINT_OUT_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+void midi_ep_task(void) {
+    flush_report_buffered(USB_ENDPOINT_IN_MIDI, false);
+}
+
 #endif
 
 #ifdef VIRTSER_ENABLE
@@ -71,6 +71,13 @@ static host_driver_t *driver;
 static uint16_t       last_system_usage   = 0;
 static uint16_t       last_consumer_usage = 0;
 
+#ifdef HOST_REPORT_SCHEDULER
+#    include <string.h>
+#    include "timer.h"
+
+static void host_report_scheduler_flush(void);
+#endif
+
 void host_set_driver(host_driver_t *d) {
     driver = d;
 }
@@ -111,11 +118,17 @@ void host_task(void) {
 #ifdef CONNECTION_ENABLE
     connection_host_t next_host = connection_get_host();
     if (next_host != active_host) {
+#    ifdef HOST_REPORT_SCHEDULER
+        host_report_scheduler_flush();
+#    endif
         host_update_active_driver(active_host, next_host);
 
         active_host = next_host;
     }
 #endif
+#ifdef HOST_REPORT_SCHEDULER
+    host_report_scheduler_task();
+#endif
 }
 
 static host_driver_t *host_get_active_driver(void) {
@@ -178,6 +191,10 @@ void host_keyboard_send(report_keyboard_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_keyboard) return;
 
+#ifdef HOST_REPORT_SCHEDULER
+    // Whatever is held back happened before this, and the host has to see it in that order
+    host_report_scheduler_flush();
+#endif
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
@@ -196,6 +213,9 @@ void host_nkro_send(report_nkro_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_nkro) return;
 
+#ifdef HOST_REPORT_SCHEDULER
+    host_report_scheduler_flush();
+#endif
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
 
@@ -208,7 +228,7 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
-void host_mouse_send(report_mouse_t *report) {
+static void host_mouse_send_now(report_mouse_t *report) {
     host_driver_t *driver = host_get_active_driver();
     if (!driver || !driver->send_mouse) return;
 
@@ -223,32 +243,229 @@ void host_mouse_send(report_mouse_t *report) {
     (*driver->send_mouse)(report);
 }
 
+static void host_extra_send_now(report_extra_t *report) {
+    host_driver_t *driver = host_get_active_driver();
+    if (!driver || !driver->send_extra) return;
+
+    (*driver->send_extra)(report);
+}
+
+#ifdef HOST_REPORT_SCHEDULER
+/*
+ * Mouse, extra key and joystick reports are not latency critical on their own,
+ * so instead of enqueueing each one as soon as it is built, the latest one is
+ * held back and sent just before the host is expected to poll. Changes within
+ * one poll interval are merged where that loses nothing (mouse movement,
+ * joystick axes), otherwise the held report is sent first. Any other report,
+ * held or not, sends everything held first, so that the host still sees input
+ * in the order it happened.
+ *
+ * The poll interval and phase are learned from host_report_serviced(), which
+ * the USB driver calls whenever an IN transfer completes on an endpoint that
+ * carries one of these reports. Two completions in a row are one interval
+ * apart when the second report was already queued when the first completed,
+ * or when it was a held report sent less than an interval after the first
+ * completed. Until the interval is known, or when the host polls faster than
+ * HOST_REPORT_SCHEDULER_LEAD allows to make use of, reports are sent
+ * immediately.
+ */
+static volatile uint32_t last_service_time    = 0;
+static volatile uint8_t  service_interval     = 0;
+static uint8_t           service_endpoint     = 0;
+static bool              service_back_to_back = false;
+static volatile uint32_t held_sent_time       = 0;
+static volatile bool     held_sent            = false;
+static uint8_t           window_min           = UINT8_MAX;
+static uint8_t           window_samples       = 0;
+
+static uint32_t pending_since = 0;
+static bool     mouse_pending = false;
+static bool     extra_pending[2];
+#    ifdef MOUSE_ENABLE
+static report_mouse_t pending_mouse;
+#    endif
+static report_extra_t pending_extra[2];
+#    ifdef JOYSTICK_ENABLE
+static bool              joystick_pending = false;
+static report_joystick_t pending_joystick;
+#    endif
+
+void host_report_serviced(uint8_t endpoint, bool more_pending) {
+    uint32_t now = timer_read32();
+
+    // A held report sent before the next poll is picked up by it, the same as one that was queued already
+    bool next_poll = service_back_to_back;
+    if (held_sent) {
+        next_poll |= TIMER_DIFF_32(held_sent_time, last_service_time) < service_interval;
+        held_sent = false;
+    }
+
+    if (next_poll && endpoint == service_endpoint) {
+        uint32_t gap = TIMER_DIFF_32(now, last_service_time);
+        if (gap > 0) {
+            window_min = MIN(window_min, MIN(gap, UINT8_MAX));
+            if (service_interval == 0 || window_min < service_interval || ++window_samples >= HOST_REPORT_SCHEDULER_WINDOW) {
+                service_interval = window_min;
+                window_min       = UINT8_MAX;
+                window_samples   = 0;
+            }
+        }
+    }
+
+    last_service_time    = now;
+    service_endpoint     = endpoint;
+    service_back_to_back = more_pending;
+}
+
+uint8_t host_report_service_interval(void) {
+    return service_interval;
+}
+
+static bool host_report_should_defer(void) {
+    return service_interval > HOST_REPORT_SCHEDULER_LEAD;
+}
+
+static bool has_pending_reports(void) {
+    bool pending = mouse_pending || extra_pending[0] || extra_pending[1];
+#    ifdef JOYSTICK_ENABLE
+    pending |= joystick_pending;
+#    endif
+    return pending;
+}
+
+/* A held report that has to be replaced flushes everything held, so the hold time always starts with the oldest report */
+static void mark_pending(void) {
+    if (!has_pending_reports()) {
+        pending_since = timer_read32();
+    }
+}
+
+static void host_report_scheduler_flush(void) {
+    if (!has_pending_reports()) {
+        return;
+    }
+    held_sent_time = timer_read32();
+    held_sent      = true;
+
+#    ifdef MOUSE_ENABLE
+    if (mouse_pending) {
+        mouse_pending = false;
+        host_mouse_send_now(&pending_mouse);
+    }
+#    endif
+    for (uint8_t i = 0; i < ARRAY_SIZE(extra_pending); i++) {
+        if (extra_pending[i]) {
+            extra_pending[i] = false;
+            host_extra_send_now(&pending_extra[i]);
+        }
+    }
+#    ifdef JOYSTICK_ENABLE
+    if (joystick_pending) {
+        joystick_pending = false;
+        send_joystick(&pending_joystick);
+    }
+#    endif
+}
+
+void host_report_scheduler_task(void) {
+    if (!has_pending_reports()) {
+        return;
+    }
+
+    uint8_t  interval = service_interval;
+    uint32_t now      = timer_read32();
+    // Never hold a report for longer than one poll interval, even if the host stopped polling
+    if (interval <= HOST_REPORT_SCHEDULER_LEAD || TIMER_DIFF_32(now, pending_since) + HOST_REPORT_SCHEDULER_LEAD >= interval) {
+        host_report_scheduler_flush();
+        return;
+    }
+
+    uint32_t since_poll = TIMER_DIFF_32(now, last_service_time) % interval;
+    if (since_poll + HOST_REPORT_SCHEDULER_LEAD >= interval) {
+        host_report_scheduler_flush();
+    }
+}
+
+#    ifdef MOUSE_ENABLE
+#        define MOUSE_MERGE(field, min, max)                                                                 \
+            do {                                                                                             \
+                int32_t sum = (int32_t)pending_mouse.field + report->field;                                  \
+                if (sum < (min) || sum > (max)) return false;                                                \
+                merged.field = sum;                                                                          \
+            } while (0)
+
+static bool host_mouse_merge(report_mouse_t *report) {
+    if (pending_mouse.buttons != report->buttons) {
+        return false;
+    }
+    report_mouse_t merged = *report;
+    MOUSE_MERGE(x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    MOUSE_MERGE(y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    MOUSE_MERGE(h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    MOUSE_MERGE(v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    pending_mouse = merged;
+    return true;
+}
+#    endif
+#endif
+
+void host_mouse_send(report_mouse_t *report) {
+#if defined(HOST_REPORT_SCHEDULER) && defined(MOUSE_ENABLE)
+    if (host_report_should_defer()) {
+        if (mouse_pending && host_mouse_merge(report)) {
+            return;
+        }
+        if (mouse_pending) {
+            host_report_scheduler_flush();
+        }
+        mark_pending();
+        pending_mouse = *report;
+        mouse_pending = true;
+        return;
+    }
+    host_report_scheduler_flush();
+#endif
+    host_mouse_send_now(report);
+}
+
+static void host_extra_send(report_extra_t *report) {
+#ifdef HOST_REPORT_SCHEDULER
+    if (host_report_should_defer()) {
+        // Every usage change has to reach the host, so a held one is sent before it is replaced
+        uint8_t slot = report->report_id == REPORT_ID_SYSTEM ? 0 : 1;
+        if (extra_pending[slot]) {
+            host_report_scheduler_flush();
+        }
+        mark_pending();
+        pending_extra[slot] = *report;
+        extra_pending[slot] = true;
+        return;
+    }
+    host_report_scheduler_flush();
+#endif
+    host_extra_send_now(report);
+}
+
 void host_system_send(uint16_t usage) {
     if (usage == last_system_usage) return;
     last_system_usage = usage;
 
-    host_driver_t *driver = host_get_active_driver();
-    if (!driver || !driver->send_extra) return;
-
     report_extra_t report = {
         .report_id = REPORT_ID_SYSTEM,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    host_extra_send(&report);
 }
 
 void host_consumer_send(uint16_t usage) {
     if (usage == last_consumer_usage) return;
     last_consumer_usage = usage;
 
-    host_driver_t *driver = host_get_active_driver();
-    if (!driver || !driver->send_extra) return;
-
     report_extra_t report = {
         .report_id = REPORT_ID_CONSUMER,
         .usage     = usage,
     };
-    (*driver->send_extra)(&report);
+    host_extra_send(&report);
 }
 
 #ifdef JOYSTICK_ENABLE
@@ -304,6 +521,29 @@ void host_joystick_send(joystick_t *joystick) {
 #    endif
     };
 
+#    ifdef HOST_REPORT_SCHEDULER
+    if (host_report_should_defer()) {
+        // Axes are absolute so the newest report wins, but button and hat changes must not be lost
+        if (joystick_pending) {
+            bool merge = true;
+#        if JOYSTICK_BUTTON_COUNT > 0
+            merge &= memcmp(pending_joystick.buttons, report.buttons, sizeof(report.buttons)) == 0;
+#        endif
+#        ifdef JOYSTICK_HAS_HAT
+            merge &= pending_joystick.hat == report.hat;
+#        endif
+            if (!merge) {
+                host_report_scheduler_flush();
+            }
+        }
+        mark_pending();
+        pending_joystick = report;
+        joystick_pending = true;
+        return;
+    }
+    host_report_scheduler_flush();
+#    endif
+
     send_joystick(&report);
 }
 #endif
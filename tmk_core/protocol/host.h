@@ -49,6 +49,22 @@ void    host_raw_hid_send(uint8_t *data, uint8_t length);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+#ifdef HOST_REPORT_SCHEDULER
+/* How many milliseconds before the expected host poll deferred reports are sent */
+#    ifndef HOST_REPORT_SCHEDULER_LEAD
+#        define HOST_REPORT_SCHEDULER_LEAD 1
+#    endif
+/* Number of measured poll intervals after which the estimate is allowed to grow again */
+#    ifndef HOST_REPORT_SCHEDULER_WINDOW
+#        define HOST_REPORT_SCHEDULER_WINDOW 32
+#    endif
+
+/* called by the USB driver when an IN transfer of a deferrable report completes, may be called from interrupt context */
+void    host_report_serviced(uint8_t endpoint, bool more_pending);
+uint8_t host_report_service_interval(void);
+void    host_report_scheduler_task(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
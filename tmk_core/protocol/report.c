@@ -23,20 +23,25 @@
 #include "util.h"
 #include <string.h>
 
+#ifdef NKRO_ENABLE
+// Maintained by add_key_bit()/del_key_bit() so the NKRO report never has to be scanned
+static uint8_t nkro_key_count  = 0;
+static bool    nkro_keys_dirty = false;
+#endif
+
 /** \brief has_anykey
  *
  * FIXME: Needs doc
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        return nkro_key_count;
     }
 #endif
+    uint8_t  cnt = 0;
+    uint8_t* p   = keyboard_report->keys;
+    uint8_t  lp  = sizeof(keyboard_report->keys);
     while (lp--) {
         if (*p++) cnt++;
     }
@@ -50,10 +55,19 @@ uint8_t has_anykey(void) {
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+        if (!nkro_key_count) {
+            return 0;
+        }
+        // Skip over empty bytes a word at a time, the report is little-endian like every supported MCU
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i += sizeof(uint32_t)) {
+            uint32_t word = 0;
+            memcpy(&word, &nkro_report->bits[i], MIN(sizeof(uint32_t), NKRO_REPORT_BITS - i));
+            if (word) {
+                i += __builtin_ctzl(word) >> 3;
+                return i << 3 | biton(nkro_report->bits[i]);
+            }
+        }
+        return 0;
     }
 #endif
     return keyboard_report->keys[0];
@@ -120,13 +134,34 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code) {
 }
 
 #ifdef NKRO_ENABLE
+/** \brief Number of keys currently set in the NKRO report
+ */
+uint8_t nkro_report_key_count(void) {
+    return nkro_key_count;
+}
+
+/** \brief Whether keys were added to or removed from the NKRO report since clear_nkro_report_dirty()
+ */
+bool is_nkro_report_dirty(void) {
+    return nkro_keys_dirty;
+}
+
+void clear_nkro_report_dirty(void) {
+    nkro_keys_dirty = false;
+}
+
 /** \brief add key bit
  *
- * FIXME: Needs doc
+ * Sets the key in the NKRO report, keeping the key count and dirty flag up to date.
  */
 void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] |= 1 << (code & 7);
+        uint8_t mask = 1 << (code & 7);
+        if (!(nkro_report->bits[code >> 3] & mask)) {
+            nkro_report->bits[code >> 3] |= mask;
+            nkro_key_count++;
+            nkro_keys_dirty = true;
+        }
     } else {
         dprintf("add_key_bit: can't add: %02X\n", code);
     }
@@ -134,11 +169,16 @@ void add_key_bit(report_nkro_t* nkro_report, uint8_t code) {
 
 /** \brief del key bit
  *
- * FIXME: Needs doc
+ * Clears the key from the NKRO report, keeping the key count and dirty flag up to date.
  */
 void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
     if ((code >> 3) < NKRO_REPORT_BITS) {
-        nkro_report->bits[code >> 3] &= ~(1 << (code & 7));
+        uint8_t mask = 1 << (code & 7);
+        if (nkro_report->bits[code >> 3] & mask) {
+            nkro_report->bits[code >> 3] &= ~mask;
+            nkro_key_count--;
+            nkro_keys_dirty = true;
+        }
     } else {
         dprintf("del_key_bit: can't del: %02X\n", code);
     }
@@ -181,7 +221,11 @@ void clear_keys_from_report(void) {
     // not clear mods
 #ifdef NKRO_ENABLE
     if (host_can_send_nkro() && keymap_config.nkro) {
-        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+        if (nkro_key_count) {
+            memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
+            nkro_key_count  = 0;
+            nkro_keys_dirty = true;
+        }
         return;
     }
 #endif
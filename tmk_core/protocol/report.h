@@ -347,8 +347,11 @@ bool    is_key_pressed(uint8_t key);
 void add_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 #ifdef NKRO_ENABLE
-void add_key_bit(report_nkro_t* nkro_report, uint8_t code);
-void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+void    add_key_bit(report_nkro_t* nkro_report, uint8_t code);
+void    del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+uint8_t nkro_report_key_count(void);
+bool    is_nkro_report_dirty(void);
+void    clear_nkro_report_dirty(void);
 #endif
 
 void add_key_to_report(uint8_t key);
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+"""Turns the console output of a firmware built with BINARY_LOG_ENABLE back into text.
+
+The format strings are read from the `qmk_log_formats` section of the ELF file
+of the same build. Console output that isn't a binary record is passed through.
+
+    cat /dev/hidraw4 | util/binary_log_decoder.py .build/handwired_onekey_blackpill_f411_default.elf
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MARKER = 0x01
+SECTION = 'qmk_log_formats'
+SPECIFIER = re.compile(r'%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diuxXocsbp%])')
+
+
+def read_formats(elf_path):
+    """Returns the contents of the format string section of an ELF file.
+    """
+    with open(elf_path, 'rb') as f:
+        elf = f.read()
+
+    if elf[:4] != b'\x7fELF':
+        raise ValueError(f'{elf_path} is not an ELF file')
+    is_64 = elf[4] == 2
+    endian = '<' if elf[5] == 1 else '>'
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + 'Q', elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', elf, 0x3A)
+        header = endian + 'IIQQQQ'
+    else:
+        shoff, = struct.unpack_from(endian + 'I', elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', elf, 0x2E)
+        header = endian + 'IIIIII'
+
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+    for name, _, _, _, offset, size in sections:
+        end = elf.index(b'\0', names_offset + name)
+        if elf[names_offset + name:end].decode() == SECTION:
+            return elf[offset:offset + size]
+
+    raise ValueError(f'{elf_path} has no {SECTION} section, was it built with BINARY_LOG_ENABLE?')
+
+
+def read_arguments(payload):
+    """Splits a record payload into its arguments, integers and strings, as the format asks for them.
+    """
+    position = 0
+
+    def next_int():
+        nonlocal position
+        value = shift = 0
+        while position < len(payload):
+            byte = payload[position]
+            position += 1
+            value |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return value
+        return None
+
+    def next_str():
+        nonlocal position
+        if position >= len(payload):
+            return None
+        end = payload.find(b'\0', position)
+        end = len(payload) if end < 0 else end
+        value = payload[position:end].decode(errors='replace')
+        position = end + 1
+        return value
+
+    return next_int, next_str
+
+
+def format_record(formats, payload):
+    """Rebuilds the text of one record.
+    """
+    if len(payload) < 2:
+        return '<truncated binary log record>\n'
+
+    record_id = payload[0] | payload[1] << 8
+    if record_id >= len(formats):
+        return f'<unknown binary log format {record_id}>\n'
+    fmt = formats[record_id:formats.index(b'\0', record_id)].decode(errors='replace')
+    next_int, next_str = read_arguments(payload[2:])
+
+    def substitute(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        value = next_str() if conversion == 's' else next_int()
+        if value is None:
+            return '…'
+
+        spec = '%' + flags + width + ('.' + precision if precision else '')
+        if conversion in 'di':
+            return (spec + 'd') % (value - (1 << 32) if value & 0x80000000 else value)
+        if conversion == 'b':
+            return format(value, ('0' if '0' in flags else '') + width + 'b')
+        if conversion == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if conversion == 'p':
+            return '0x%x' % value
+        return (spec + conversion) % value
+
+    return SPECIFIER.sub(substitute, fmt)
+
+
+def decode(stream, formats, output):
+    """Decodes the console stream, writing text and decoded records to `output` as they arrive.
+    """
+    while True:
+        byte = stream.read(1)
+        if not byte:
+            return
+
+        if byte[0] == 0:
+            # Padding of the console reports
+            continue
+
+        if byte[0] != MARKER:
+            output.write(byte.decode(errors='replace'))
+            continue
+
+        length = stream.read(1)
+        if not length:
+            return
+        output.write(format_record(formats, stream.read(length[0])))
+        output.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decodes binary log records from the QMK console.')
+    parser.add_argument('elf', help='the ELF file of the firmware that is running')
+    parser.add_argument('input', nargs='?', help='the captured console output, standard input if not given')
+    args = parser.parse_args()
+
+    formats = read_formats(args.elf)
+    if args.input:
+        with open(args.input, 'rb') as stream:
+            decode(stream, formats, sys.stdout)
+    else:
+        decode(sys.stdin.buffer, formats, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()